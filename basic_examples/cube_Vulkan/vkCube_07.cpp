@@ -12,6 +12,7 @@
 //------------------------------------------------------------------------------
 #include <vulkan/vulkan.hpp>
 #include <shaderc/shaderc.hpp>
+#include "utils/spirvCache.h"
 
 #include <iostream>
 #include <stdexcept>
@@ -123,26 +124,8 @@ void vkAppBase::buildImagesView()
 /////////////////////////////////////////////
 void vkAppBase::compileShaders()
 {
-    shaderc::Compiler compiler;
-    shaderc::CompileOptions options;
-#ifdef NDEBUG
-    options.SetOptimizationLevel(shaderc_optimization_level_performance);
-#else
-    options.SetOptimizationLevel(shaderc_optimization_level_zero);
-#endif
-    shaderc::SpvCompilationResult vertShaderModule = compiler.CompileGlslToSpv((char *)vertCode, shaderc_glsl_vertex_shader, "vertex shader", options);
-    if(vertShaderModule.GetCompilationStatus() != shaderc_compilation_status_success) std::cerr << vertShaderModule.GetErrorMessage();
-
-    const auto vertShaderCode = std::vector<uint32_t>{ vertShaderModule.cbegin(), vertShaderModule.cend() };
-    const vk::ShaderModuleCreateInfo vertShaderCreateInfo({}, vertShaderCode.size()*sizeof(uint32_t), vertShaderCode.data());
-    vertShaderMod = logicalDevice.createShaderModule(vertShaderCreateInfo);
-
-    const shaderc::SpvCompilationResult fragShaderModule = compiler.CompileGlslToSpv((char *)fragCode, shaderc_glsl_fragment_shader, "fragment shader", options);
-    if (fragShaderModule.GetCompilationStatus() != shaderc_compilation_status_success) std::cerr << fragShaderModule.GetErrorMessage();
-
-    const auto fragShaderCode = std::vector<uint32_t>{ fragShaderModule.cbegin(), fragShaderModule.cend() };
-    vk::ShaderModuleCreateInfo fragShaderCreateInfo({}, fragShaderCode.size()*sizeof(uint32_t), fragShaderCode.data());
-    fragShaderMod = logicalDevice.createShaderModule(fragShaderCreateInfo);
+    // SPIR-V from on-disk cache (SPIRV_CACHE_DIR): shaderc compiles only on first run or when source/options/compiler change
+    spirvCache::createShaderModules(logicalDevice, vertCode, fragCode, vertShaderMod, fragShaderMod);
 }
 
 void vkAppBase::buildRenderPass()
@@ -33,7 +33,7 @@
 #endif
 
 #include "assets/cubePC.h"
-#include "utils/sleepTimer.h"
+#include "utils/framePacer.h"
 
 void renderWidgets(vg::vGizmo3D &track, vec3& vLight, int width, int height);
 
@@ -672,13 +672,20 @@ int main(int, char**)
     // Main loop
     emscripten_set_main_loop([] { glfwPollEvents(); mainLoop(); }, 0, false);
 #else
+    // frame pacer (60 FPS): DAWN examples have a fixed "SLEEP timer" (16ms), w/o (sometime) you get "Device Lost" error
+    // here the wait is to the next frame deadline (frame time compensated) and when nothing moves it waits input events
+    framePacer pacer(60);
+
     // Main loop
     while (!glfwWindowShouldClose(fwWindow)) {
         glfwPollEvents();   // Poll and handle events (inputs, window resize, etc.)
         mainLoop();
         surface.Present();
-        // this is really a "SLEEP timer" (16ms = 60 FPS), it's present in all DAWN examples
-        waitFor(16000);     // w/o (sometime) you get "Device Lost" error
+        pacer.endFrame();
+        if(pacer.shouldBlock(vgizmo.isIdleRotating() || ImGui::IsAnyItemActive())) {
+            glfwWaitEventsTimeout(pacer.getIdleTimeout());
+            pacer.resync();
+        }
     }
 
     // Cleanup
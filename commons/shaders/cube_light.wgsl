@@ -25,6 +25,15 @@ R"(
     // Model View Projection matrix.
     @group(0) @binding(0) var<uniform> u : ubo;
 
+    // many objects instances (vsInstances entry point only): commons/utils/instanceData.h gpuInstance
+    struct instanceData {
+        rot      : vec4f,   // orientation quaternion: x, y, z, w
+        posScale : vec4f,   // xyz: world position, w: uniform scale
+    };
+    @group(0) @binding(1) var<storage, read> inst : array<instanceData>;
+
+    fn qRotate(q: vec4f, v: vec3f) -> vec3f { return v + 2.0 * cross(q.xyz, cross(q.xyz, v) + q.w * v); }
+
     struct vertIn
     {
         @location(0) pos: vec4f,
@@ -76,6 +85,19 @@ R"(
         return out;
     }
 
+    @vertex fn vsInstances(in: vertIn) -> vertOut
+    {
+        var out: vertOut;
+        let o = inst[in.instanceID];
+        out.color = in.color;
+        out.normal = vec4f(qRotate(o.rot, in.normal.xyz), 1.0);
+        out.pos = vec4f(o.posScale.xyz + qRotate(o.rot, in.pos.xyz * o.posScale.w), 1.0);
+        out.shininessExp = 100.f;
+
+        out.gPos = u.pMat * u.vMat * u.cMat * out.pos;
+        return out;
+    }
+
     @fragment fn fs(in: fragIn) -> @location(0) vec4f {
 
         let ambientInt  : f32 = 0.25;
@@ -27,6 +27,18 @@ layout (std140, binding = 0) uniform uBuffer
 } u;
 #endif
 
+// many objects instances (gl_InstanceIndex >= 2): commons/utils/instanceData.h gpuInstance
+struct instanceData {
+    vec4 rot;       // orientation quaternion: x, y, z, w
+    vec4 posScale;  // xyz: world position, w: uniform scale
+};
+layout (std430, binding = 2) readonly buffer instBuffer
+{
+    instanceData inst[];
+};
+
+vec3 qRotate(vec4 q, vec3 v) { return v + 2.0 * cross(q.xyz, cross(q.xyz, v) + q.w * v); }
+
 layout (location = 0) in vec3 pos;
 layout (location = 1) in vec3 normal;
 layout (location = 2) in vec3 inColor;
@@ -48,11 +60,20 @@ void main()
         gl_Position = u.pMat * u.vMat * u.cMat * vsPos;
         shininessExp = 500.f;   // BlinnPhong: use (about!) shininessExp*3 for similar Phong rendering apparence (view fragment)
     }
-    else {                          // light
+    else if(VTX_INSTANCE==0) {      // light
         vsNormal = vec4(mat3(u.lMat) * normal, 1.0);
         vsPos = u.lMat * vec4(pos, 1.0);
         vsColor = vec4(1.0, 1.0, 0.5, 1.0);        // light-cube have uniform color...
         shininessExp = 0.f;                         // and shininessExp have no sense
         gl_Position = u.pMat * u.vMat * u.cMat * u.lMat * vec4(pos*.1, 1.0);   // pos*.1 = reducing light-cube
     }
+    else {                          // instances: VTX_INSTANCE-2 (GL: gl_InstanceID from bound range, VK: firstInstance included)
+        instanceData o = inst[VTX_INSTANCE-2];
+        vsColor = vec4(inColor, 1.0);
+        vsNormal = vec4(qRotate(o.rot, normal), 1.0);
+        vsPos = vec4(o.posScale.xyz + qRotate(o.rot, pos * o.posScale.w), 1.0);
+
+        gl_Position = u.pMat * u.vMat * u.cMat * vsPos;
+        shininessExp = 100.f;
+    }
 }
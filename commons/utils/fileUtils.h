@@ -0,0 +1,55 @@
+//------------------------------------------------------------------------------
+//  Copyright (c) 2025 Michele Morrone
+//  All rights reserved.
+//
+//  https://michelemorrone.eu - https://brutpitt.com
+//
+//  X: https://x.com/BrutPitt - GitHub: https://github.com/BrutPitt
+//
+//  direct mail: brutpitt(at)gmail.com - me(at)michelemorrone.eu
+//
+//  This software is distributed under the terms of the BSD 2-Clause license
+//------------------------------------------------------------------------------
+#pragma once
+
+#include <string>
+#include <cstdint>
+#include <cstddef>
+#include <fstream>
+#include <chrono>
+#include <filesystem>
+
+// Helpers shared by the on-disk caches (pipelineCacheFile.h, spirvCache.h)
+// and the input traces (inputTrace.h)
+//
+//  fnv1a(...): 64 bit FNV-1a hash, chainable (h: hash of previous data)
+//  writeAtomic(...): header + payload to a temporary file, then renamed
+//      ==> no partial files, also with concurrent instances
+//------------------------------------------------------------------------------
+namespace fileUtils {
+
+inline uint64_t fnv1a(const void *data, size_t size, uint64_t h = 0xcbf29ce484222325ull)
+{
+    const uint8_t *p = (const uint8_t *) data;
+    for(size_t i = 0; i < size; i++) { h ^= p[i]; h *= 0x100000001b3ull; }
+    return h;
+}
+
+// false if not written (e.g. read-only dir: callers use it as "no cache", not an error)
+inline bool writeAtomic(const std::string &fileName, const void *header, size_t headerSize, const void *payload, size_t payloadSize)
+{
+    std::error_code ec;
+    const std::string tmpName = fileName + "." + std::to_string(std::chrono::steady_clock::now().time_since_epoch().count()) + ".tmp";
+    {
+        std::ofstream file(tmpName, std::ios::binary | std::ios::trunc);
+        if(!file.is_open()) return false;
+        file.write((const char *) header, headerSize);
+        file.write((const char *) payload, payloadSize);
+        if(!file.good()) { file.close(); std::filesystem::remove(tmpName, ec); return false; }
+    }
+    std::filesystem::rename(tmpName, fileName, ec);
+    if(ec) { std::filesystem::remove(tmpName, ec); return false; }
+    return true;
+}
+
+} // end namespace fileUtils
@@ -0,0 +1,163 @@
+//------------------------------------------------------------------------------
+//  Copyright (c) 2025 Michele Morrone
+//  All rights reserved.
+//
+//  https://michelemorrone.eu - https://brutpitt.com
+//
+//  X: https://x.com/BrutPitt - GitHub: https://github.com/BrutPitt
+//
+//  direct mail: brutpitt(at)gmail.com - me(at)michelemorrone.eu
+//
+//  This software is distributed under the terms of the BSD 2-Clause license
+//------------------------------------------------------------------------------
+#pragma once
+
+#include <chrono>
+#include <thread>
+#include <cmath>
+#include <cstdint>
+
+// Frame pacer: fixed frame time target with measured work compensation
+//
+//  Deadlines are absolute (start + N * target): frame work time is compensated,
+//  late frames are counted as missed and the schedule restarts from now (no burst
+//  to recover lost frames).
+//  Wait is hybrid: sleep until (deadline - spin margin), then yield-spin until
+//  deadline; the margin follows the measured oversleep of the OS timer (Windows
+//  ~1..15 ms, Linux/macOS ~50..100 us) ==> sub-ms accuracy with few CPU wakeups
+//
+//  Idle mode: nothing is animating for some frames ==> shouldBlock() is true,
+//  app waits input events (glfwWaitEventsTimeout / SDL_WaitEventTimeout) with
+//  getIdleTimeout(), then calls resync()
+//
+//      framePacer pacer(60);               // target 60 fps (0 ==> no wait, only stats)
+//      pacer.calibrate();                  // optional: initial spin margin from OS timer
+//      while(loop) {
+//          if(pacer.shouldBlock(animating)) { waitEvents(pacer.getIdleTimeout()); pacer.resync(); }
+//          pollEvents(); ... render ...
+//          pacer.endFrame();               // wait to the deadline
+//      }
+//------------------------------------------------------------------------------
+class framePacer {
+public:
+    using clock = std::chrono::steady_clock;
+
+    struct stats {
+        uint64_t frames = 0;        // paced frames
+        uint64_t missed = 0;        // work time > target (deadline already expired)
+        uint64_t idleWaits = 0;     // blocking waits (shouldBlock() == true)
+        double avgWorkUs = 0;       // frame work (endFrame - previous deadline)
+        double avgFrameUs = 0;      // measured frame intervals (endFrame return to endFrame return)
+        double jitterUs = 0;        // RMS of (interval - target) of not missed frames
+        double maxLateUs = 0;       // max wake up delay after a deadline
+        uint64_t lateWakes = 0;     // wake up delay > min spin margin: OS timer / scheduler stall
+    };
+
+    explicit framePacer(double fps = 60.0) { setTargetFPS(fps); }
+
+    void   setTargetFPS(double fps)       { setTargetFrameTime(fps > 0 ? 1e6 / fps : 0.0); }
+    void   setTargetFrameTime(double us)  { targetUs = us > 0 ? us : 0; resync(); }
+    double getTargetFrameTime() const     { return targetUs; }
+
+    // spin margin limits (microseconds): min / max time of yield-spin before deadline
+    void setSpinLimits(double minUs, double maxUs) { minSpinUs = minUs; maxSpinUs = maxUs < minUs ? minUs : maxUs; spinUs = clampSpin(spinUs); }
+    // initial spin margin from max oversleep of "samples" sleeps of 1 ms (otherwise it
+    // starts from 2 ms and adapts only after oversleeps), return max oversleep (us)
+    double calibrate(int samples = 10) {
+        double maxOver = 0;
+        for(int i = 0; i < samples; i++) {
+            const clock::time_point wakeAt = clock::now() + std::chrono::milliseconds(1);
+            std::this_thread::sleep_until(wakeAt);
+            const double over = micro(clock::now() - wakeAt);
+            maxOver = over > maxOver ? over : maxOver;
+        }
+        spinUs = clampSpin(maxOver * 1.5 + minSpinUs);
+        resync();
+        return maxOver;
+    }
+    // idle: block after "frames" consecutive not animating frames, wait timeout in seconds
+    void   setIdle(int frames, double timeoutSec) { idleFrames = frames; idleTimeout = timeoutSec; }
+    double getIdleTimeout() const { return idleTimeout; }
+
+    // call before to process events: true ==> app can block waiting events
+    bool shouldBlock(bool animating) {
+        if(animating) { notAnimatingCount = 0; return false; }
+        if(idleFrames <= 0 || ++notAnimatingCount <= idleFrames) return false;
+        st.idleWaits++;
+        return true;
+    }
+
+    // restart the schedule from now (e.g. after a blocking wait or a pause):
+    // after a wait some frames are rendered before to block again (ImGui needs
+    // more frames to update hover/focus states)
+    void resync() {
+        lastDeadline = lastWake = clock::now();
+        notAnimatingCount = 0;
+        wasResync = true;
+    }
+
+    // end of frame work: wait until next deadline (no wait if targetUs == 0)
+    void endFrame() {
+        const clock::time_point now = clock::now();
+        const double workUs = micro(now - lastDeadline);
+
+        clock::time_point deadline = lastDeadline + std::chrono::duration_cast<clock::duration>(std::chrono::duration<double, std::micro>(targetUs));
+        bool missed = now >= deadline;
+        if(targetUs <= 0) deadline = now;
+        else if(!missed) waitUntil(deadline);
+
+        const clock::time_point wake = clock::now();
+        if(missed) deadline = wake;                 // restart schedule: no burst
+        accumulate(workUs, micro(wake - lastWake), targetUs > 0 && missed, micro(wake - deadline));
+        lastDeadline = deadline;
+        lastWake = wake;
+    }
+
+    const stats &getStats() const { return st; }
+    void resetStats() { st = stats(); sumSqJitter = 0; jitterFrames = 0; }
+    double getSpinMargin() const { return spinUs; }
+
+private:
+    static double micro(clock::duration d) { return std::chrono::duration<double, std::micro>(d).count(); }
+    double clampSpin(double us) const { return us < minSpinUs ? minSpinUs : (us > maxSpinUs ? maxSpinUs : us); }
+
+    void waitUntil(clock::time_point deadline) {
+        const clock::time_point wakeAt = deadline - std::chrono::duration_cast<clock::duration>(std::chrono::duration<double, std::micro>(spinUs));
+        clock::time_point now = clock::now();
+        if(now < wakeAt) {
+            std::this_thread::sleep_until(wakeAt);
+            now = clock::now();
+            // oversleep of OS timer ==> spin margin (fast attack, slow release)
+            const double over = micro(now - wakeAt);
+            const double want = over * 1.5 + minSpinUs;
+            spinUs = clampSpin(spinUs + (want > spinUs ? .5 : .02) * (want - spinUs));
+        }
+        while(clock::now() < deadline) std::this_thread::yield();
+    }
+
+    void accumulate(double workUs, double frameUs, bool missed, double lateUs) {
+        if(wasResync) { wasResync = false; return; }    // first frame after wait/start: not a paced interval
+        const double n = double(++st.frames);
+        st.avgWorkUs  += (workUs  - st.avgWorkUs ) / n;
+        st.avgFrameUs += (frameUs - st.avgFrameUs) / n;
+        if(missed) st.missed++;
+        else if(targetUs > 0) {
+            const double d = frameUs - targetUs;
+            sumSqJitter += d * d;
+            st.jitterUs = std::sqrt(sumSqJitter / double(++jitterFrames));
+            if(lateUs > st.maxLateUs) st.maxLateUs = lateUs;
+            if(lateUs > minSpinUs) st.lateWakes++;
+        }
+    }
+
+    stats st;
+    double sumSqJitter = 0;
+    uint64_t jitterFrames = 0;
+
+    clock::time_point lastDeadline = clock::now(), lastWake = lastDeadline;
+    double targetUs = 0;
+    double spinUs = 2000, minSpinUs = 200, maxSpinUs = 20000;
+    int idleFrames = 3, notAnimatingCount = 0;
+    double idleTimeout = .5;
+    bool wasResync = true;
+};
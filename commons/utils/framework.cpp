@@ -60,6 +60,7 @@ void frameworkBase::initVGizmo3D(vg::vGizmo3D &vgTrackball)     // Settings to c
         int w, h;
         getFramebufferSize(&w, &h);        
         vgTrackball.viewportSize(w, h);         // is necessary also to call when resize window/surface: re-calibrate drag rotation & auto-set mouse sensitivity
+        if(traceRecorder) { traceRecorder->viewport(w, h); traceRecorder->state(vgTrackball); } // trace starts from current size/rotations/position
     // track.setGizmoFeeling(1.0);              // but if you need to more feeling with the mouse use: 1.0 default,  > 1.0 more sensible, < 1.0 less sensible
 
     // setIdleRotSpeed(1.0)                     // If used Idle() feature (continue rotation on Idle) it set that speed: more speed > 1.0 ,  less < 1.0
@@ -76,6 +77,18 @@ void frameworkBase::initVGizmo3D(vg::vGizmo3D &vgTrackball)     // Settings to c
     // Watch vGizmo.h for more functionalities
 }
 
+/// Input trace: new frame + ImGui input state (mouse pos, buttons, key mods, wheel) to replay ImGui widgets
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+void frameworkBase::traceNewFrame()
+{
+    if(!traceRecorder) return;
+    traceRecorder->newFrame();
+    const ImGuiIO &io = ImGui::GetIO();
+    int downMask = 0;
+    for(int i = 0; i < 5; i++) if(io.MouseDown[i]) downMask |= 1 << i;
+    traceRecorder->imguiFrame(io.MousePos.x, io.MousePos.y, downMask, int(io.KeyMods) >> 12, io.MouseWheel, io.MouseWheelH);
+}
+
 #if defined(APP_USES_SDL2) || defined(APP_USES_SDL3)
 frameworkSDL::frameworkSDL(int32_t width, int32_t height, const char *title, uint32_t flags, const char *fmk) :
     frameworkBase(title, fmk) {
@@ -144,6 +157,7 @@ int frameworkSDL::getVGizmo3DKeyModifier() {
 //~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
 void frameworkSDL::checkVGizmo3DMouseEvent(vg::vGizmo3D &vgTrackball) {
     static int leftPress = 0, rightPress = 0, middlePress = 0;
+    traceNewFrame();
     if(!ImGui::GetIO().WantCaptureMouse) {
 #ifdef APP_USES_SDL2
         int x, y;
@@ -153,24 +167,24 @@ void frameworkSDL::checkVGizmo3DMouseEvent(vg::vGizmo3D &vgTrackball) {
         int mouseState = SDL_GetMouseState(&x, &y);
         if(leftPress != (mouseState & SDL_BUTTON_LMASK)) {                  // check if leftButton state is changed
             leftPress =  mouseState & SDL_BUTTON_LMASK ;                    // set new (different!) state
-            vgTrackball.mouse(vg::evLeftButton, getVGizmo3DKeyModifier(),   // send communication to vGizmo3D...
+            gizmoMouse(vgTrackball, vg::evLeftButton, getVGizmo3DKeyModifier(),   // send communication to vGizmo3D...
                                           leftPress, x, y);                 // ... checking if a key modifier currently is pressed
         }
         if(rightPress != (mouseState & SDL_BUTTON_RMASK)) {                 // check if rightButton state is changed
             rightPress =  mouseState & SDL_BUTTON_RMASK;                    // set new (different!) state
-            vgTrackball.mouse(vg::evRightButton, getVGizmo3DKeyModifier(),  // send communication to vGizmo3D...
+            gizmoMouse(vgTrackball, vg::evRightButton, getVGizmo3DKeyModifier(),  // send communication to vGizmo3D...
                                            rightPress, x, y);               // ... checking if a key modifier currently is pressed
         }
         // Simulating a double press (left+right button) using MIDDLE button,
         // sending two "consecutive" activation/deactivation to rotate cube and light spot together
         if(middlePress != (mouseState & SDL_BUTTON_MMASK)) {             // check if middleButton state is changed
             middlePress =  mouseState & SDL_BUTTON_MMASK;                // set new (different!) middle button state
-            vgTrackball.mouse(vg::evRightButton, getVGizmo3DKeyModifier(), middlePress, x, y);  // call Right activation/deactivation with same "middleStatus"
-            vgTrackball.mouse(vg::evLeftButton,  getVGizmo3DKeyModifier(), middlePress, x, y);  // call Left  activation/deactivation with same "middleStatus"
+            gizmoMouse(vgTrackball, vg::evRightButton, getVGizmo3DKeyModifier(), middlePress, x, y);  // call Right activation/deactivation with same "middleStatus"
+            gizmoMouse(vgTrackball, vg::evLeftButton,  getVGizmo3DKeyModifier(), middlePress, x, y);  // call Left  activation/deactivation with same "middleStatus"
         }
 // vGizmo3D: if "drag" active update internal rotations (primary and secondary)
 //~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
-        vgTrackball.motion(x,y);
+        gizmoMotion(vgTrackball, x, y);
     }
 }
 
@@ -267,30 +281,31 @@ int frameworkClass::getVGizmo3DKeyModifier()
 void frameworkClass::checkVGizmo3DMouseEvent(vg::vGizmo3D &vgTrackball)
 {
         static int leftPress = 0, rightPress = 0, middlePress = 0;
+    traceNewFrame();
     if(!ImGui::GetIO().WantCaptureMouse) {
         double x, y;
         glfwGetCursorPos(getWindow(), &x, &y);
         if(glfwGetMouseButton(getWindow(), GLFW_MOUSE_BUTTON_LEFT) != leftPress) {  // check if leftButton state is changed
             leftPress = leftPress == GLFW_PRESS ? GLFW_RELEASE : GLFW_PRESS;        // set new (different!) state
-            vgTrackball.mouse(vg::evLeftButton, getVGizmo3DKeyModifier(),           // send communication to vGizmo3D...
+            gizmoMouse(vgTrackball, vg::evLeftButton, getVGizmo3DKeyModifier(),           // send communication to vGizmo3D...
                                           leftPress, x, y);                         // ... checking if a key modifier currently is pressed
         }
         if(glfwGetMouseButton(getWindow(), GLFW_MOUSE_BUTTON_RIGHT) != rightPress) { // same thing for rightButton
             rightPress = rightPress == GLFW_PRESS ? GLFW_RELEASE : GLFW_PRESS;
-            vgTrackball.mouse(vg::evRightButton, getVGizmo3DKeyModifier(),
+            gizmoMouse(vgTrackball, vg::evRightButton, getVGizmo3DKeyModifier(),
                                            rightPress, x, y);
         }
         // Just a trik: simulating a double press (left+right button together) using MIDDLE button,
         // sending two "consecutive" activation/deactivation calls to rotate cube and light spot together
         if(glfwGetMouseButton(getWindow(), GLFW_MOUSE_BUTTON_MIDDLE) != middlePress) {         // check if middleButton state is changed
             middlePress = middlePress == GLFW_PRESS ? GLFW_RELEASE : GLFW_PRESS;               // set new (different!) middle button state
-            vgTrackball.mouse(vg::evLeftButton, getVGizmo3DKeyModifier(),  middlePress, x, y); // call Left activation/deactivation with same "middleStatus"
-            vgTrackball.mouse(vg::evRightButton, getVGizmo3DKeyModifier(), middlePress, x, y); // call Right activation/deactivation with same "middleStatus"
+            gizmoMouse(vgTrackball, vg::evLeftButton, getVGizmo3DKeyModifier(),  middlePress, x, y); // call Left activation/deactivation with same "middleStatus"
+            gizmoMouse(vgTrackball, vg::evRightButton, getVGizmo3DKeyModifier(), middlePress, x, y); // call Right activation/deactivation with same "middleStatus"
         }
 
     // vGizmo3D: if "drag" active update internal rotations (primary and secondary)
     //~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
-        vgTrackball.motion(x,y);
+        gizmoMotion(vgTrackball, x, y);
         //vgTrackball.motion(x,y,vgTrackball.getDollyPosition().z);
     }
 }
@@ -19,6 +19,8 @@
 // declare before "imgui" includes, or anywhere if IMGUI_DEFINE_MATH_OPERATORS
 #include <imguizmo_quat.h>
 
+#include "inputTrace.h"
+
 #ifdef APP_USES_SDL2
     #include <SDL2/SDL.h>
     #include <SDL2/SDL_vulkan.h>
@@ -50,6 +52,7 @@ public:
     virtual void quit()          const = 0;
     virtual bool createSurface(const vk::Instance &instance, vk::SurfaceKHR *surface) = 0;
     virtual bool pollEvents() = 0;
+    virtual void waitEvents(double timeoutSec) = 0;     // block until an event or timeout (framePacer idle)
     virtual void getFramebufferSize(int *w, int *h) const = 0;
     virtual int  getVGizmo3DKeyModifier() = 0;
     virtual void checkVGizmo3DMouseEvent(vg::vGizmo3D &vgTrackball) = 0;
@@ -65,7 +68,24 @@ public:
 //~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
     void initVGizmo3D(vg::vGizmo3D &track);
 
+/// Input trace recording (inputTrace.h): events sent to vGizmo3D and ImGui input, every frame <br>
+/// nullptr (default) ==> no recording
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+    void setInputTraceRecorder(inputTrace::recorder *rec) { traceRecorder = rec; }
+    inputTrace::recorder *getInputTraceRecorder() const { return traceRecorder; }
+
 protected:
+    void traceNewFrame();
+    void gizmoMouse(vg::vGizmo3D &vgTrackball, vg::vgButtons button, vg::vgModifiers mod, bool pressed, float x, float y) {
+        vgTrackball.mouse(button, mod, pressed, x, y);
+        if(traceRecorder) traceRecorder->mouse(button, mod, pressed, x, y);
+    }
+    void gizmoMotion(vg::vGizmo3D &vgTrackball, float x, float y) {
+        vgTrackball.motion(x, y);
+        if(traceRecorder) traceRecorder->motion(x, y);
+    }
+
+    inputTrace::recorder *traceRecorder = nullptr;
     vk::Instance instance;
     vk::PhysicalDevice physicalDevice;
     vk::SurfaceKHR surface;
@@ -92,6 +112,7 @@ public:
     void getReqExtensions();
 
     bool pollEvents();
+    void waitEvents(double timeoutSec) { SDL_WaitEventTimeout(nullptr, int(timeoutSec * 1000.0)); }   // event stays in queue
 
     void destroyWindow() const { SDL_DestroyWindow(getWindow());  }
     void quit()          const { SDL_Quit(); }
@@ -187,6 +208,7 @@ public:
 
     bool windowShouldClose() const { return glfwWindowShouldClose(getWindow()); }
     bool pollEvents() { glfwPollEvents(); return !glfwWindowShouldClose(getWindow()); }
+    void waitEvents(double timeoutSec) { glfwWaitEventsTimeout(timeoutSec); }
 
     void destroyWindow() const { glfwDestroyWindow(getWindow());  }
     void quit() const { glfwTerminate(); }
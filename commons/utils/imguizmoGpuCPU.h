@@ -0,0 +1,216 @@
+//------------------------------------------------------------------------------
+//  Copyright (c) 2025 Michele Morrone
+//  All rights reserved.
+//
+//  https://michelemorrone.eu - https://brutpitt.com
+//
+//  X: https://x.com/BrutPitt - GitHub: https://github.com/BrutPitt
+//
+//  direct mail: brutpitt(at)gmail.com - me(at)michelemorrone.eu
+//
+//  This software is distributed under the terms of the BSD 2-Clause license
+//------------------------------------------------------------------------------
+#pragma once
+
+#include <cmath>
+#include <vector>
+
+#include <imguizmo_quat.h>
+
+// ImGuIZMO.quat GPU path: CPU reference rasterizer (no graphics API)
+//
+//  Rasterizes an ImDrawData like a backend: ImGui triangles (texture ignored,
+//  white) and gizmo draw callbacks (imguiGizmo::setDrawCallback) with the same
+//  instances, transforms, back face culling and per fragment lighting that a
+//  backend implements in its shaders (vertexShader / fragmentShader below).
+//  Used to validate GPU path against CPU triangles (examples/tools/gizmoGpuRef)
+//  and as reference implementation for new backends
+//
+//      imguiGizmo::setDrawCallback(imguizmoGpuCPU::drawCallback);
+//      ... ImGui::Render();
+//      imguizmoGpuCPU::rasterizer r(width, height);
+//      r.render(ImGui::GetDrawData());     // r.pixels(): RGBA float
+//------------------------------------------------------------------------------
+namespace imguizmoGpuCPU {
+
+// only a marker: the rasterizer recognizes it and draws the record
+inline void drawCallback(const ImDrawList*, const ImDrawCmd*) {}
+
+class rasterizer {
+public:
+    rasterizer(int w = 0, int h = 0) { resize(w, h); }
+
+    void resize(int w, int h) { width = w; height = h; image.assign(size_t(w) * h * 4, 0.f); }
+    void clear(float r, float g, float b, float a = 1.f) {
+        for(size_t i = 0; i < image.size(); i += 4) { image[i] = r; image[i+1] = g; image[i+2] = b; image[i+3] = a; }
+    }
+
+    void render(const ImDrawData *drawData) {
+        const ImVec2 off = drawData->DisplayPos;
+        for(int n = 0; n < drawData->CmdListsCount; n++) {
+            const ImDrawList *list = drawData->CmdLists[n];
+            for(int c = 0; c < list->CmdBuffer.Size; c++) {
+                const ImDrawCmd *cmd = &list->CmdBuffer[c];
+                const ImVec4 clip(cmd->ClipRect.x - off.x, cmd->ClipRect.y - off.y, cmd->ClipRect.z - off.x, cmd->ClipRect.w - off.y);
+                if(cmd->UserCallback == drawCallback) drawGizmo(imguiGizmo::getDrawRecord(cmd), clip, off);
+                else if(cmd->UserCallback == ImDrawCallback_ResetRenderState) continue;
+                else if(cmd->UserCallback) cmd->UserCallback(list, cmd);
+                else drawImGui(list, cmd, clip, off);
+            }
+        }
+    }
+
+    const float *pixels() const { return image.data(); }
+    int getWidth()  const { return width;  }
+    int getHeight() const { return height; }
+    // instances/triangles drawn through gizmo callbacks (last render calls)
+    int instancesCount = 0, trianglesCount = 0;
+
+private:
+    struct fragIn { float color[4], meshNormal[3], normalZ, posZ; };
+    struct vtxOut { float x, y; fragIn f; };
+
+    static void qRotate(const float q[4], const float v[3], float r[3]) {  // v + 2*cross(q.xyz, cross(q.xyz, v) + q.w*v)
+        const float t[3] = { q[1]*v[2] - q[2]*v[1] + q[3]*v[0], q[2]*v[0] - q[0]*v[2] + q[3]*v[1], q[0]*v[1] - q[1]*v[0] + q[3]*v[2] };
+        r[0] = v[0] + 2.f * (q[1]*t[2] - q[2]*t[1]);
+        r[1] = v[1] + 2.f * (q[2]*t[0] - q[0]*t[2]);
+        r[2] = v[2] + 2.f * (q[0]*t[1] - q[1]*t[0]);
+    }
+    static void fastRotate(int axis, const float v[3], float r[3]) {
+        if     (axis == 1) { r[0] = -v[1]; r[1] = v[0]; r[2] = v[2]; }
+        else if(axis == 2) { r[0] = -v[2]; r[1] = v[1]; r[2] = v[0]; }
+        else               { r[0] =  v[0]; r[1] = v[1]; r[2] = v[2]; }
+    }
+    static float clamp01(float v) { return v < 0.f ? 0.f : (v > 1.f ? 1.f : v); }
+
+    // vertex stage
+    static vtxOut vertexShader(const imguiGizmo::gpuVertex &v, const imguiGizmo::gpuInstance &i, const ImVec2 &off) {
+        vtxOut o;
+        const int axis = int(i.screen[3]);
+        const float p0[3] = { v.pos[0] * i.xform[0] + i.xform[1], v.pos[1] * i.xform[2], v.pos[2] * i.xform[3] };
+        float p1[3], p[3], n1[3], n[3];
+        fastRotate(axis, p0, p1);     qRotate(i.rot, p1, p);
+        fastRotate(axis, v.norm, n1); qRotate(i.normRot, n1, n);
+
+        const float *col = (int(i.light[0]) == imguiGizmo::lightSphere && v.tess > .5f) ? i.color2 : i.color;
+        for(int k = 0; k < 4; k++) o.f.color[k] = col[k];
+        for(int k = 0; k < 3; k++) o.f.meshNormal[k] = v.norm[k];
+        o.f.normalZ = n[2];
+        o.f.posZ = p[2];
+        o.x = i.screen[0] + p[0] * i.screen[2] - off.x;
+        o.y = i.screen[1] - p[1] * i.screen[2] - off.y;
+        return o;
+    }
+
+    // fragment stage
+    static void fragmentShader(const fragIn &f, int light, float lightParam, float out[4]) {
+        if(light == imguiGizmo::lightSphere) {
+            const float ds = lightParam;
+            const float lt = -ds*.5f + (f.posZ*f.posZ) / (ds*ds);
+            const float l = (lt < .6f ? .6f : lt) * .8f;
+            for(int k = 0; k < 3; k++) out[k] = clamp01(f.color[k] * l + lt * (80.f/255.f));
+        } else {
+            const float atten = (light == imguiGizmo::lightArrow && f.posZ <= 0.f) ? f.posZ * .5f : f.posZ;
+            const float l = f.normalZ < .5f ? .5f : f.normalZ;
+            const float a = atten > .25f ? .25f : atten;
+            for(int k = 0; k < 3; k++) {
+                const float col = light == imguiGizmo::lightCube ? std::fabs(f.meshNormal[k]) : f.color[k];
+                out[k] = clamp01(((col + l*.5f) * l) * .75f + a*col*.45f + a*.25f);
+            }
+        }
+        out[3] = f.color[3];
+    }
+
+    // blend: SrcAlpha, OneMinusSrcAlpha (color) - One, OneMinusSrcAlpha (alpha) as ImGui backends
+    void blend(int x, int y, const float c[4]) {
+        float *d = &image[(size_t(y) * width + x) * 4];
+        for(int k = 0; k < 3; k++) d[k] = c[k] * c[3] + d[k] * (1.f - c[3]);
+        d[3] = c[3] + d[3] * (1.f - c[3]);
+    }
+
+    // pixel centers, top-left fill rule (shared edges drawn once)
+    template <class SHADE>
+    void triangle(const float *x, const float *y, const ImVec4 &clip, SHADE &&shade) {
+        float area = (x[1]-x[0]) * (y[2]-y[0]) - (y[1]-y[0]) * (x[2]-x[0]);
+        if(area == 0.f) return;
+        int i0 = 0, i1 = 1, i2 = 2;
+        if(area < 0.f) { i1 = 2; i2 = 1; area = -area; }    // same orientation for edge functions
+        const float X[3] = { x[i0], x[i1], x[i2] }, Y[3] = { y[i0], y[i1], y[i2] };
+        const int idx[3] = { i0, i1, i2 };
+
+        const int minX = int(std::floor(std::fmax(std::fmin(X[0], std::fmin(X[1], X[2])), clip.x)));
+        const int maxX = int(std::ceil (std::fmin(std::fmax(X[0], std::fmax(X[1], X[2])), clip.z)));
+        const int minY = int(std::floor(std::fmax(std::fmin(Y[0], std::fmin(Y[1], Y[2])), clip.y)));
+        const int maxY = int(std::ceil (std::fmin(std::fmax(Y[0], std::fmax(Y[1], Y[2])), clip.w)));
+
+        auto edge = [&](int a, int b, float px, float py) { return (X[b]-X[a]) * (py-Y[a]) - (Y[b]-Y[a]) * (px-X[a]); };
+        auto topLeft = [&](int a, int b) { const float dx = X[b]-X[a], dy = Y[b]-Y[a]; return (dy == 0.f && dx < 0.f) || dy > 0.f; };
+        const bool tl[3] = { topLeft(1, 2), topLeft(2, 0), topLeft(0, 1) };
+
+        for(int py = minY < 0 ? 0 : minY; py < maxY && py < height; py++)
+            for(int px = minX < 0 ? 0 : minX; px < maxX && px < width; px++) {
+                const float cx = px + .5f, cy = py + .5f;
+                if(cx < clip.x || cx >= clip.z || cy < clip.y || cy >= clip.w) continue;
+                const float w[3] = { edge(1, 2, cx, cy), edge(2, 0, cx, cy), edge(0, 1, cx, cy) };
+                bool inside = true;
+                for(int k = 0; k < 3; k++) inside &= w[k] > 0.f || (w[k] == 0.f && tl[k]);
+                if(!inside) continue;
+                float b[3];
+                for(int k = 0; k < 3; k++) b[idx[k]] = w[k] / area;
+                float c[4];
+                shade(b, c);
+                blend(px, py, c);
+            }
+    }
+
+    void drawImGui(const ImDrawList *list, const ImDrawCmd *cmd, const ImVec4 &clip, const ImVec2 &off) {
+        for(unsigned int e = 0; e + 2 < cmd->ElemCount; e += 3) {
+            const ImDrawVert *v[3];
+            float x[3], y[3];
+            for(int k = 0; k < 3; k++) {
+                v[k] = &list->VtxBuffer[cmd->VtxOffset + list->IdxBuffer[cmd->IdxOffset + e + k]];
+                x[k] = v[k]->pos.x - off.x; y[k] = v[k]->pos.y - off.y;
+            }
+            const ImVec4 c[3] = { ImGui::ColorConvertU32ToFloat4(v[0]->col), ImGui::ColorConvertU32ToFloat4(v[1]->col), ImGui::ColorConvertU32ToFloat4(v[2]->col) };
+            triangle(x, y, clip, [&](const float *b, float *out) {
+                out[0] = c[0].x*b[0] + c[1].x*b[1] + c[2].x*b[2]; out[1] = c[0].y*b[0] + c[1].y*b[1] + c[2].y*b[2];
+                out[2] = c[0].z*b[0] + c[1].z*b[1] + c[2].z*b[2]; out[3] = c[0].w*b[0] + c[1].w*b[1] + c[2].w*b[2];
+            });
+        }
+    }
+
+    void drawGizmo(const imguiGizmo::drawRecord &rec, const ImVec4 &clip, const ImVec2 &off) {
+        if(!meshVtx.size()) imguiGizmo::buildMeshes(meshVtx, meshRanges);
+        imguiGizmo::buildInstances(rec, instances, batches);
+        for(const imguiGizmo::gpuBatch &batch : batches)
+            for(int i = batch.firstInstance; i < batch.firstInstance + batch.instanceCount; i++) {
+                const imguiGizmo::gpuInstance &inst = instances[i];
+                const int light = int(inst.light[0]);
+                const imguiGizmo::meshRange &r = meshRanges[batch.mesh];
+                for(int t = r.firstVertex; t < r.firstVertex + r.vertexCount; t += 3) {
+                    const vtxOut o[3] = { vertexShader(meshVtx[t], inst, off), vertexShader(meshVtx[t+1], inst, off), vertexShader(meshVtx[t+2], inst, off) };
+                    const float x[3] = { o[0].x, o[1].x, o[2].x }, y[3] = { o[0].y, o[1].y, o[2].y };
+                    // back face: same test of CPU path (screen y down)
+                    if((x[1]-x[0]) * (y[2]-y[0]) - (y[1]-y[0]) * (x[2]-x[0]) > 0.f) continue;
+                    trianglesCount++;
+                    triangle(x, y, clip, [&](const float *b, float *out) {
+                        fragIn f;
+                        const float *s0 = &o[0].f.color[0], *s1 = &o[1].f.color[0], *s2 = &o[2].f.color[0];
+                        float *d = &f.color[0];
+                        for(size_t k = 0; k < sizeof(fragIn)/sizeof(float); k++) d[k] = s0[k]*b[0] + s1[k]*b[1] + s2[k]*b[2];
+                        fragmentShader(f, light, inst.light[1], out);
+                    });
+                }
+                instancesCount++;
+            }
+    }
+
+    int width = 0, height = 0;
+    std::vector<float> image;
+    ImVector<imguiGizmo::gpuVertex> meshVtx;
+    imguiGizmo::meshRange meshRanges[imguiGizmo::meshCount];
+    ImVector<imguiGizmo::gpuInstance> instances;
+    ImVector<imguiGizmo::gpuBatch> batches;
+};
+
+} // namespace imguizmoGpuCPU
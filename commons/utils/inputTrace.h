@@ -0,0 +1,162 @@
+//------------------------------------------------------------------------------
+//  Copyright (c) 2025 Michele Morrone
+//  All rights reserved.
+//
+//  https://michelemorrone.eu - https://brutpitt.com
+//
+//  X: https://x.com/BrutPitt - GitHub: https://github.com/BrutPitt
+//
+//  direct mail: brutpitt(at)gmail.com - me(at)michelemorrone.eu
+//
+//  This software is distributed under the terms of the BSD 2-Clause license
+//------------------------------------------------------------------------------
+#pragma once
+
+#include <vector>
+#include <cstdint>
+#include <cstdio>
+#include <chrono>
+
+#include "fileUtils.h"
+
+// Input trace: record / replay of vGizmo3D and ImGui input events
+//
+//  file: traceHeader + N * traceEvent (little endian, fixed size records)
+//  every event has the frame number and the time (microseconds) from start
+//  of recording: the player reproduces the same events in the same frames
+//
+//  recorder: frameworkBase::setInputTraceRecorder(&recorder) (framework.h)
+//  player:   examples/tools/tracePlayer (headless: no window, no GPU)
+//------------------------------------------------------------------------------
+namespace inputTrace {
+
+enum : uint8_t {
+    evViewport,     // x, y = width, height                 ==> viewportSize(x, y)
+    evMouse,        // button, pressed, mods, x, y          ==> mouse(button, mods, pressed, x, y)
+    evMotion,       // x, y, z = dx                         ==> motion(x, y, z)
+    evWheel,        // x, y, z = dx                         ==> wheel(x, y, z)
+    evImmediate,    // mods, x, y, dx, dy                   ==> motionImmediateMode(x, y, dx, dy, mods)
+    evIdle,         // button = 1 main / 2 second / 3 both  ==> idle() / idleSecond()
+    evRotation,     // button = 0 main / 1 second, x, y, dx, dy = quat w, x, y, z ==> setRotation / setSecondRot
+    evPosition,     // x, y, dx = pan x, pan y, dolly z     ==> setPosition
+    evImGuiFrame    // ImGui input for current frame: mouse pos (x, y), button = mouse down mask (bit 0..4)
+                    //      mods = ImGuiMod_Ctrl|Shift|Alt|Super >> 12, dx / dy = wheel V / H
+};
+
+constexpr char     traceMagic[4] = { 'V', 'G', 'T', 'R' };
+constexpr uint16_t traceVersion  = 1;
+
+#pragma pack(push, 4)
+struct traceHeader {
+    char     magic[4];
+    uint16_t version, eventSize;
+};
+
+struct traceEvent {
+    uint32_t frame, timeUs;
+    uint8_t  type, button, pressed, mods;
+    float    x, y, dx, dy;
+};
+#pragma pack(pop)
+static_assert(sizeof(traceEvent) == 28, "traceEvent: fixed size record");
+
+//  Recorder
+//////////////////////////////////////////////////////////////////
+class recorder {
+public:
+    ~recorder() { close(); }
+
+    bool open(const char *fileName) {
+        close();
+        file = fopen(fileName, "wb");
+        if(!file) return false;
+        const traceHeader header { { traceMagic[0], traceMagic[1], traceMagic[2], traceMagic[3] }, traceVersion, uint16_t(sizeof(traceEvent)) };
+        fwrite(&header, sizeof(header), 1, file);
+        frame = 0;
+        start = std::chrono::steady_clock::now();
+        return true;
+    }
+    void close() { if(file) { flush(); fclose(file); file = nullptr; } }
+    bool isRecording() const { return file != nullptr; }
+
+    void newFrame() { frame++; if(events.size() >= flushSize) flush(); }
+
+    void viewport (float w, float h)                                  { add(evViewport,  0, 0, 0, w, h); }
+    void mouse    (int button, int mods, bool pressed, float x, float y) { add(evMouse, button, pressed, mods, x, y); }
+    void motion   (float x, float y, float z = 0)                     { add(evMotion,    0, 0, 0, x, y, z); }
+    void wheel    (float x, float y, float z = 0)                     { add(evWheel,     0, 0, 0, x, y, z); }
+    void immediate(float x, float y, float dx, float dy, int mods)    { add(evImmediate, 0, 0, mods, x, y, dx, dy); }
+    void idle     (bool main, bool second)                            { add(evIdle, (main ? 1 : 0) | (second ? 2 : 0), 0, 0, 0, 0); }
+    template<class G> void state(G &g) {    // current vGizmo3D state: rotations and position
+        const auto q = g.getRotation(), qs = g.getSecondRot();
+        const auto p = g.getPosition();
+        add(evRotation, 0, 0, 0, q.w,  q.x,  q.y,  q.z);
+        add(evRotation, 1, 0, 0, qs.w, qs.x, qs.y, qs.z);
+        add(evPosition, 0, 0, 0, p.x,  p.y,  p.z);
+    }
+    void imguiFrame(float x, float y, int downMask, int mods, float wheel, float wheelH) { add(evImGuiFrame, downMask, 0, mods, x, y, wheel, wheelH); }
+
+private:
+    void add(uint8_t type, int button, int pressed, int mods, float x, float y, float dx = 0, float dy = 0) {
+        if(!file) return;
+        const uint32_t us = uint32_t(std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start).count());
+        events.push_back({ frame, us, type, uint8_t(button), uint8_t(pressed), uint8_t(mods), x, y, dx, dy });
+    }
+    void flush() {
+        if(file && !events.empty()) fwrite(events.data(), sizeof(traceEvent), events.size(), file);
+        events.clear();
+    }
+
+    static constexpr size_t flushSize = 4096;
+    std::vector<traceEvent> events;
+    FILE *file = nullptr;
+    uint32_t frame = 0;
+    std::chrono::steady_clock::time_point start;
+};
+
+//  Loader: all events, in recording order
+//////////////////////////////////////////////////////////////////
+inline bool load(const char *fileName, std::vector<traceEvent> &events)
+{
+    FILE *file = fopen(fileName, "rb");
+    if(!file) return false;
+    traceHeader header;
+    bool ok = fread(&header, sizeof(header), 1, file) == 1 &&
+              header.magic[0] == traceMagic[0] && header.magic[1] == traceMagic[1] &&
+              header.magic[2] == traceMagic[2] && header.magic[3] == traceMagic[3] &&
+              header.version == traceVersion && header.eventSize == sizeof(traceEvent);
+    traceEvent ev;
+    events.clear();
+    while(ok && fread(&ev, sizeof(ev), 1, file) == 1) events.push_back(ev);
+    fclose(file);
+    return ok;
+}
+
+//  Apply a vGizmo3D event (evImGuiFrame is ignored): G = vGizmo3D or compatible
+//////////////////////////////////////////////////////////////////
+template<class G> inline void apply(G &gizmo, const traceEvent &ev)
+{
+    switch(ev.type) {
+        case evViewport:  gizmo.viewportSize(ev.x, ev.y); break;
+        case evMouse:     gizmo.mouse(ev.button, ev.mods, ev.pressed != 0, ev.x, ev.y); break;
+        case evMotion:    gizmo.motion(ev.x, ev.y, ev.dx); break;
+        case evWheel:     gizmo.wheel(ev.x, ev.y, ev.dx); break;
+        case evImmediate: gizmo.motionImmediateMode(ev.x, ev.y, ev.dx, ev.dy, ev.mods); break;
+        case evIdle:
+            if(ev.button & 1) gizmo.idle();
+            if(ev.button & 2) gizmo.idleSecond();
+            break;
+        case evRotation:
+            if(ev.button) gizmo.setSecondRot(decltype(gizmo.getSecondRot())(ev.x, ev.y, ev.dx, ev.dy));
+            else          gizmo.setRotation (decltype(gizmo.getRotation ())(ev.x, ev.y, ev.dx, ev.dy));
+            break;
+        case evPosition:  gizmo.setPosition(decltype(gizmo.getPosition())(ev.x, ev.y, ev.dx)); break;
+        default: break;
+    }
+}
+
+//  64 bit FNV-1a: state hash to compare replays
+//////////////////////////////////////////////////////////////////
+using fileUtils::fnv1a;
+
+} // end namespace inputTrace
@@ -0,0 +1,198 @@
+//------------------------------------------------------------------------------
+//  Copyright (c) 2025 Michele Morrone
+//  All rights reserved.
+//
+//  https://michelemorrone.eu - https://brutpitt.com
+//
+//  X: https://x.com/BrutPitt - GitHub: https://github.com/BrutPitt
+//
+//  direct mail: brutpitt(at)gmail.com - me(at)michelemorrone.eu
+//
+//  This software is distributed under the terms of the BSD 2-Clause license
+//------------------------------------------------------------------------------
+#pragma once
+
+#include <cstdint>
+#include <cstddef>
+#include <cmath>
+#include <vector>
+#include <random>
+
+#include <vGizmo3D.h>
+
+// Per-instance data builder: many objects, each one with own orientation
+//
+//  Every object spins (own axis and speed) and all together follow the
+//  vGizmo3D rotation and pan/dolly: each frame update() composes the quaternions
+//  and writes a GPU ready buffer (std430 / WGSL storage layout) of gpuInstance:
+//  orientation and world position + uniform scale
+//
+//  The objects are stored SoA, converted 4 at time (SSE) and written AoS
+//  directly in destination: a persistently mapped region of an instance buffer
+//  (use regionBytes() to align the regions of a multi-buffered ring)
+//
+//      instanceData::builder swarm;
+//      swarm.init(100000);
+//      ... every frame, in a region no longer used from the GPU
+//      swarm.update(vgizmo.getRotation(), vgizmo.getPosition(), mappedRegion);
+//------------------------------------------------------------------------------
+namespace instanceData {
+
+struct gpuInstance {
+    float rot[4];       // orientation quaternion: x, y, z, w
+    float posScale[4];  // xyz: world position, w: uniform scale
+};
+
+class builder {
+public:
+    // objects in a spherical shell [innerRadius, outerRadius] around the origin
+    void init(uint32_t n, float innerRadius = 1.75f, float outerRadius = 5.f, float objScale = .04f, uint32_t seed = 1) {
+        count = n;
+        stride = (n + 3) & ~3u;    // SoA arrays padded to 4 elements
+        soa.assign(size_t(stride) * nArrays, 0.f);
+
+        std::mt19937 rng(seed);
+        std::uniform_real_distribution<float> u01(0.f, 1.f);
+        const float pi2 = 6.28318530718f;
+        for(uint32_t i = 0; i < n; i++) {
+            // uniform random orientation (Shoemake)
+            const float u1 = u01(rng), r1 = sqrtf(1.f - u1), r2 = sqrtf(u1);
+            const float a1 = pi2 * u01(rng), a2 = pi2 * u01(rng);
+            arr(qX)[i] = r1 * sinf(a1); arr(qY)[i] = r1 * cosf(a1);
+            arr(qZ)[i] = r2 * sinf(a2); arr(qW)[i] = r2 * cosf(a2);
+
+            // step rotation: random axis, 0.2..2 degrees for frame
+            const float z = 2.f * u01(rng) - 1.f, t = pi2 * u01(rng), rxy = sqrtf(1.f - z*z);
+            const float halfAngle = .5f * (0.2f + 1.8f * u01(rng)) * pi2 / 360.f;
+            const float s = sinf(halfAngle);
+            arr(sX)[i] = rxy * cosf(t) * s; arr(sY)[i] = rxy * sinf(t) * s;
+            arr(sZ)[i] = z * s;             arr(sW)[i] = cosf(halfAngle);
+
+            // position: uniform in the shell volume
+            const float pz = 2.f * u01(rng) - 1.f, pt = pi2 * u01(rng), pxy = sqrtf(1.f - pz*pz);
+            const float r3i = innerRadius*innerRadius*innerRadius, r3o = outerRadius*outerRadius*outerRadius;
+            const float r = cbrtf(r3i + (r3o - r3i) * u01(rng));
+            arr(pX)[i] = pxy * cosf(pt) * r; arr(pY)[i] = pxy * sinf(pt) * r; arr(pZ)[i] = pz * r;
+            arr(scl)[i] = objScale * (.5f + u01(rng));
+        }
+        // padding: identity (normalization of zeros would be NaN)
+        for(uint32_t i = n; i < stride; i++) arr(qW)[i] = arr(sW)[i] = 1.f;
+    }
+
+    uint32_t size() const { return count; }
+
+    // bytes of a ring region of count instances, aligned to device requirement (e.g. minStorageBufferOffsetAlignment)
+    size_t regionBytes(size_t alignment = 256) const {
+        const size_t bytes = size_t(count) * sizeof(gpuInstance);
+        return alignment ? (bytes + alignment - 1) / alignment * alignment : bytes;
+    }
+
+    // spin all objects of one step, then write them (rotation/position of vGizmo3D applied) in dst[0..size())
+    // Q, V: quat/vec3 float or double (e.g. vGizmo3D::getRotation()/getPosition())
+    template<class Q, class V> void update(const Q &rotation, const V &position, gpuInstance *dst) {
+#if defined(__SSE__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 1)
+        const frame f(rotation, position);
+        const uint32_t n4 = count & ~3u;
+        float *qx = arr(qX), *qy = arr(qY), *qz = arr(qZ), *qw = arr(qW);
+        const float *sx = arr(sX), *sy = arr(sY), *sz = arr(sZ), *sw = arr(sW);
+        const float *px = arr(pX), *py = arr(pY), *pz = arr(pZ), *sc = arr(scl);
+
+        const __m128 rx = _mm_set1_ps(f.r[0]), ry = _mm_set1_ps(f.r[1]), rz = _mm_set1_ps(f.r[2]), rw = _mm_set1_ps(f.r[3]);
+        const __m128 half = _mm_set1_ps(.5f), threeHalf = _mm_set1_ps(1.5f);
+        for(uint32_t i = 0; i < n4; i += 4) {
+            const __m128 ax = _mm_loadu_ps(qx+i), ay = _mm_loadu_ps(qy+i), az = _mm_loadu_ps(qz+i), aw = _mm_loadu_ps(qw+i);
+            const __m128 bx = _mm_loadu_ps(sx+i), by = _mm_loadu_ps(sy+i), bz = _mm_loadu_ps(sz+i), bw = _mm_loadu_ps(sw+i);
+            // spin: q = q * step
+            __m128 w = _mm_sub_ps(_mm_sub_ps(_mm_sub_ps(_mm_mul_ps(aw,bw), _mm_mul_ps(ax,bx)), _mm_mul_ps(ay,by)), _mm_mul_ps(az,bz));
+            __m128 x = _mm_sub_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(aw,bx), _mm_mul_ps(ax,bw)), _mm_mul_ps(ay,bz)), _mm_mul_ps(az,by));
+            __m128 y = _mm_sub_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(aw,by), _mm_mul_ps(ay,bw)), _mm_mul_ps(az,bx)), _mm_mul_ps(ax,bz));
+            __m128 z = _mm_sub_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(aw,bz), _mm_mul_ps(az,bw)), _mm_mul_ps(ax,by)), _mm_mul_ps(ay,bx));
+            // renormalize (drift): rsqrt + 1 Newton step, as fastInvSqrt
+            const __m128 n2 = _mm_add_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(x,x), _mm_mul_ps(y,y)), _mm_mul_ps(z,z)), _mm_mul_ps(w,w));
+            __m128 inv = _mm_rsqrt_ps(n2);
+            inv = _mm_mul_ps(inv, _mm_sub_ps(threeHalf, _mm_mul_ps(_mm_mul_ps(_mm_mul_ps(half, n2), inv), inv)));
+            x = _mm_mul_ps(x, inv); y = _mm_mul_ps(y, inv); z = _mm_mul_ps(z, inv); w = _mm_mul_ps(w, inv);
+            _mm_storeu_ps(qx+i, x); _mm_storeu_ps(qy+i, y); _mm_storeu_ps(qz+i, z); _mm_storeu_ps(qw+i, w);
+
+            // world orientation: rotation * q
+            __m128 ow = _mm_sub_ps(_mm_sub_ps(_mm_sub_ps(_mm_mul_ps(rw,w), _mm_mul_ps(rx,x)), _mm_mul_ps(ry,y)), _mm_mul_ps(rz,z));
+            __m128 ox = _mm_sub_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(rw,x), _mm_mul_ps(rx,w)), _mm_mul_ps(ry,z)), _mm_mul_ps(rz,y));
+            __m128 oy = _mm_sub_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(rw,y), _mm_mul_ps(ry,w)), _mm_mul_ps(rz,x)), _mm_mul_ps(rx,z));
+            __m128 oz = _mm_sub_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(rw,z), _mm_mul_ps(rz,w)), _mm_mul_ps(rx,y)), _mm_mul_ps(ry,x));
+
+            // world position: M3(rotation) * p + position
+            const __m128 ix = _mm_loadu_ps(px+i), iy = _mm_loadu_ps(py+i), iz = _mm_loadu_ps(pz+i);
+            __m128 wx = _mm_add_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(_mm_set1_ps(f.m[0]),ix), _mm_mul_ps(_mm_set1_ps(f.m[3]),iy)), _mm_mul_ps(_mm_set1_ps(f.m[6]),iz)), _mm_set1_ps(f.t[0]));
+            __m128 wy = _mm_add_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(_mm_set1_ps(f.m[1]),ix), _mm_mul_ps(_mm_set1_ps(f.m[4]),iy)), _mm_mul_ps(_mm_set1_ps(f.m[7]),iz)), _mm_set1_ps(f.t[1]));
+            __m128 wz = _mm_add_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(_mm_set1_ps(f.m[2]),ix), _mm_mul_ps(_mm_set1_ps(f.m[5]),iy)), _mm_mul_ps(_mm_set1_ps(f.m[8]),iz)), _mm_set1_ps(f.t[2]));
+            __m128 ws = _mm_loadu_ps(sc+i);
+
+            // SoA ==> AoS
+            _MM_TRANSPOSE4_PS(ox, oy, oz, ow);
+            _MM_TRANSPOSE4_PS(wx, wy, wz, ws);
+            gpuInstance *d = dst + i;
+            _mm_storeu_ps(d[0].rot, ox); _mm_storeu_ps(d[0].posScale, wx);
+            _mm_storeu_ps(d[1].rot, oy); _mm_storeu_ps(d[1].posScale, wy);
+            _mm_storeu_ps(d[2].rot, oz); _mm_storeu_ps(d[2].posScale, wz);
+            _mm_storeu_ps(d[3].rot, ow); _mm_storeu_ps(d[3].posScale, ws);
+        }
+        for(uint32_t i = n4; i < count; i++) updateOne(f, i, dst[i]);
+#else
+        updateScalar(rotation, position, dst);
+#endif
+    }
+
+    // reference (and no SSE) version of update()
+    template<class Q, class V> void updateScalar(const Q &rotation, const V &position, gpuInstance *dst) {
+        const frame f(rotation, position);
+        for(uint32_t i = 0; i < count; i++) updateOne(f, i, dst[i]);
+    }
+
+private:
+    enum { qX, qY, qZ, qW, sX, sY, sZ, sW, pX, pY, pZ, scl, nArrays };
+
+    // per frame constants (float also with double precision vGizmo3D)
+    struct frame {
+        template<class Q, class V> frame(const Q &q, const V &p) {
+            r[0] = float(q.x); r[1] = float(q.y); r[2] = float(q.z); r[3] = float(q.w);
+            const float xx = r[0]*r[0], yy = r[1]*r[1], zz = r[2]*r[2];
+            const float xy = r[0]*r[1], xz = r[0]*r[2], yz = r[1]*r[2];
+            const float wx = r[3]*r[0], wy = r[3]*r[1], wz = r[3]*r[2];
+            m[0] = 1.f - 2.f * (yy + zz); m[1] = 2.f * (xy + wz);       m[2] = 2.f * (xz - wy);          // column 0
+            m[3] = 2.f * (xy - wz);       m[4] = 1.f - 2.f * (xx + zz); m[5] = 2.f * (yz + wx);          // column 1
+            m[6] = 2.f * (xz + wy);       m[7] = 2.f * (yz - wx);       m[8] = 1.f - 2.f * (xx + yy);    // column 2
+            t[0] = float(p.x); t[1] = float(p.y); t[2] = float(p.z);
+        }
+        float r[4], m[9], t[3];
+    };
+
+    void updateOne(const frame &f, uint32_t i, gpuInstance &d) {
+        float &qx = arr(qX)[i], &qy = arr(qY)[i], &qz = arr(qZ)[i], &qw = arr(qW)[i];
+        const float bx = arr(sX)[i], by = arr(sY)[i], bz = arr(sZ)[i], bw = arr(sW)[i];
+        float w = qw*bw - qx*bx - qy*by - qz*bz;
+        float x = qw*bx + qx*bw + qy*bz - qz*by;
+        float y = qw*by + qy*bw + qz*bx - qx*bz;
+        float z = qw*bz + qz*bw + qx*by - qy*bx;
+        const float inv = fastInvSqrt(x*x + y*y + z*z + w*w);
+        qx = x *= inv; qy = y *= inv; qz = z *= inv; qw = w *= inv;
+
+        const float *r = f.r;
+        d.rot[3] = r[3]*w - r[0]*x - r[1]*y - r[2]*z;
+        d.rot[0] = r[3]*x + r[0]*w + r[1]*z - r[2]*y;
+        d.rot[1] = r[3]*y + r[1]*w + r[2]*x - r[0]*z;
+        d.rot[2] = r[3]*z + r[2]*w + r[0]*y - r[1]*x;
+
+        const float px = arr(pX)[i], py = arr(pY)[i], pz = arr(pZ)[i], *m = f.m;
+        d.posScale[0] = m[0]*px + m[3]*py + m[6]*pz + f.t[0];
+        d.posScale[1] = m[1]*px + m[4]*py + m[7]*pz + f.t[1];
+        d.posScale[2] = m[2]*px + m[5]*py + m[8]*pz + f.t[2];
+        d.posScale[3] = arr(scl)[i];
+    }
+
+    float *arr(int idx) { return soa.data() + size_t(idx) * stride; }
+
+    std::vector<float> soa;
+    uint32_t count = 0, stride = 0;
+};
+
+} // namespace instanceData
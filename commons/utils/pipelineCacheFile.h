@@ -0,0 +1,90 @@
+//------------------------------------------------------------------------------
+//  Copyright (c) 2025 Michele Morrone
+//  All rights reserved.
+//
+//  https://michelemorrone.eu - https://brutpitt.com
+//
+//  X: https://x.com/BrutPitt - GitHub: https://github.com/BrutPitt
+//
+//  direct mail: brutpitt(at)gmail.com - me(at)michelemorrone.eu
+//
+//  This software is distributed under the terms of the BSD 2-Clause license
+//------------------------------------------------------------------------------
+#pragma once
+
+#include <vector>
+#include <string>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <filesystem>
+
+#include "fileUtils.h"
+
+// On-disk pipeline cache (vkGetPipelineCacheData blob) between runs
+//
+//  read(...) returns the blob saved by a previous run only if it was produced by
+//  the same device: vendor/device ID, pipelineCacheUUID, driver and API version
+//  (a driver update changes driverVersion ==> blob discarded, also if the
+//  driver doesn't change its UUID), otherwise the app starts with an empty cache
+//
+//  file: header { magic, format, device, size, payload hash } + blob
+//      wrong/truncated header, device or payload hash ==> ignored and rewritten
+//  write: fileUtils::writeAtomic (temporary file, then renamed)
+//
+//  -DPIPELINE_CACHE_FILE=file ==> cache file (default: "vkPipelineCache.bin" in working dir)
+//  -DPIPELINE_CACHE_DISABLED ==> always empty cache (as before)
+//------------------------------------------------------------------------------
+#ifndef PIPELINE_CACHE_FILE
+    #define PIPELINE_CACHE_FILE "vkPipelineCache.bin"
+#endif
+
+namespace pipelineCacheFile {
+
+constexpr uint32_t cacheMagic  = 0x43505643;   // "CVPC"
+constexpr uint32_t cacheFormat = 1;
+
+// from VkPhysicalDeviceProperties
+struct deviceId {
+    uint32_t vendorID, deviceID, driverVersion, apiVersion;
+    uint8_t  uuid[16];     // pipelineCacheUUID
+};
+
+struct cacheHeader {
+    uint32_t magic, format;
+    deviceId device;
+    uint64_t size, hash;
+};
+
+inline bool read(const char *fileName, const deviceId &device, std::vector<uint8_t> &blob)
+{
+    blob.clear();
+    std::ifstream file(fileName, std::ios::binary);
+    if(!file.is_open()) return false;
+
+    cacheHeader header;
+    if(!file.read((char *) &header, sizeof(header))) return false;
+    if(header.magic != cacheMagic || header.format != cacheFormat || !header.size ||
+       memcmp(&header.device, &device, sizeof(deviceId))) return false;
+
+    blob.resize(header.size);
+    if(!file.read((char *) blob.data(), header.size) || file.peek() != EOF ||
+       fileUtils::fnv1a(blob.data(), blob.size()) != header.hash) { blob.clear(); return false; }
+    return true;
+}
+
+inline void write(const char *fileName, const deviceId &device, const std::vector<uint8_t> &blob)
+{
+    if(blob.empty()) return;
+    std::error_code ec;
+    const std::filesystem::path parent = std::filesystem::path(fileName).parent_path();
+    if(!parent.empty()) std::filesystem::create_directories(parent, ec);
+
+    cacheHeader header;
+    memset(&header, 0, sizeof(header));     // padding bytes too: file content is deterministic
+    header.magic = cacheMagic; header.format = cacheFormat; header.device = device;
+    header.size = blob.size(); header.hash = fileUtils::fnv1a(blob.data(), blob.size());
+    fileUtils::writeAtomic(fileName, &header, sizeof(header), blob.data(), blob.size());
+}
+
+} // end namespace pipelineCacheFile
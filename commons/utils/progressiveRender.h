@@ -0,0 +1,144 @@
+//------------------------------------------------------------------------------
+//  Copyright (c) 2025 Michele Morrone
+//  All rights reserved.
+//
+//  https://michelemorrone.eu - https://brutpitt.com
+//
+//  X: https://x.com/BrutPitt - GitHub: https://github.com/BrutPitt
+//
+//  direct mail: brutpitt(at)gmail.com - me(at)michelemorrone.eu
+//
+//  This software is distributed under the terms of the BSD 2-Clause license
+//------------------------------------------------------------------------------
+#pragma once
+
+#include <cmath>
+#include <cstring>
+
+// Progressive refinement: reduced resolution while view changes, full quality when idle
+//
+//  While the gizmo is dragged, inertia is running or the view changed (dirty),
+//  every frame is rendered with an "interactive" pass: resolution scale adapted
+//  to the frame time budget (cost ~ pixels ~ scale^2).
+//  When all stops, refine passes are rendered one for frame (e.g. full resolution,
+//  then high quality), after the last one the image is complete: nothing to
+//  render, reuse the last image (blit)
+//
+//  No graphics API: the app renders the pass (scale, quality) and gives back
+//  the measured time (frameTime)
+//
+//      progressive::scheduler sched;
+//      progressive::pass p;
+//      if(sched.next(progressive::isActive(gizmo), viewChanged, p)) {
+//          render(width * p.scale, height * p.scale, p.quality); // measure it
+//          sched.frameTime(ms);    // or frameTime(ms, p) when the time is read later
+//      }
+//      present (upscale) last rendered image
+//------------------------------------------------------------------------------
+namespace progressive {
+
+struct pass {
+    float scale;    // resolution scale (0..1]
+    int quality;    // app defined: e.g. 0 = fast, 1 = high quality
+};
+
+class scheduler {
+public:
+    enum { maxRefinePasses = 8 };
+
+    scheduler() {
+        const pass p[] = { { 1.f, 0 }, { 1.f, 1 } };
+        setRefinePasses(p, 2);
+    }
+
+    // target time (milliseconds) of interactive passes
+    void  setBudget(float ms) { budgetMs = ms > 0.f ? ms : budgetMs; }
+    float getBudget() const   { return budgetMs; }
+    // interactive resolution scale limits
+    void setScaleLimits(float minS, float maxS = 1.f) {
+        minScale = minS; maxScale = maxS < minS ? minS : maxS;
+        scale = clampScale(scale);
+    }
+    // passes rendered (one for frame) after interaction, last one is the final image
+    void setRefinePasses(const pass *passes, int count) {
+        nRefine = count < 0 ? 0 : (count > maxRefinePasses ? maxRefinePasses : count);
+        for(int i = 0; i < nRefine; i++) refine[i] = passes[i];
+        restart();
+    }
+    void setInteractiveQuality(int q) { interactiveQuality = q; }
+    // refine passes with quality > maxQuality are skipped (e.g. high quality disabled)
+    void setQualityLimit(int maxQuality) { qualityLimit = maxQuality; }
+
+    // start again from interactive pass (e.g. after resize or any change)
+    void restart() { refineIdx = -1; lastInteractive = false; lastPass = { 1.f, -1 }; }
+
+    // active: gizmo dragged / inertia (isActive()), dirty: view or params changed
+    // return false if image is complete: nothing to render
+    bool next(bool active, bool dirty, pass &p) {
+        if(active || dirty || refineIdx < 0) {
+            p = { scale, interactiveQuality };
+            refineIdx = 0;
+            lastInteractive = true;
+            lastPass = p;
+            return true;
+        }
+        lastInteractive = false;
+        while(refineIdx < nRefine && refine[refineIdx].quality > qualityLimit) refineIdx++;
+        if(refineIdx < nRefine) { p = lastPass = refine[refineIdx++]; return true; }
+        return false;
+    }
+
+    // measured time (milliseconds) of last pass: passes of interactive quality
+    // (also refine ones) update the cost estimate ==> next interactive scale
+    void frameTime(float ms) { frameTime(ms, lastPass); }
+    // measured time of pass "p" rendered before: e.g. GPU timer query read back
+    // one or more frames later (no pipeline stall)
+    void frameTime(float ms, const pass &p) {
+        if(p.quality != interactiveQuality || ms <= 0.f) return;
+        const float cost = ms / (p.scale * p.scale);    // ms of a full resolution pass
+        fullCost = fullCost > 0.f ? fullCost + (cost - fullCost) * smoothing : cost;
+        scale = clampScale(std::sqrt(budgetMs / fullCost));
+    }
+
+    float getScale() const      { return scale; }       // current interactive scale
+    float getFullCost() const   { return fullCost; }    // estimated ms at full resolution
+    bool  isComplete() const    { return refineIdx >= nRefine; }
+    bool  isInteractive() const { return lastInteractive; }
+    int   getRefineIndex() const { return refineIdx; }  // -1 = none rendered yet, nRefine = complete
+
+private:
+    float clampScale(float s) const { return s < minScale ? minScale : (s > maxScale ? maxScale : s); }
+
+    pass refine[maxRefinePasses];
+    pass lastPass = { 1.f, -1 };
+    int nRefine = 0, refineIdx = -1;
+    int interactiveQuality = 0, qualityLimit = 1 << 30;
+    bool lastInteractive = false;
+    float budgetMs = 12.f;
+    float minScale = .25f, maxScale = 1.f;
+    float scale = .5f;
+    float fullCost = 0.f;
+    float smoothing = .3f;
+};
+
+// vGizmo3D (or compatible) active: dragging, pan/dolly or inertia spin
+template<class G> inline bool isActive(G &gizmo)
+{
+    return gizmo.isRotationActive() || gizmo.isPanActive() || gizmo.isDollyActive() || gizmo.isIdleRotating();
+}
+
+// dirty flag of a state (POD, padding zeroed: memcmp): true if different from last call
+template<class S> class changeTracker {
+public:
+    bool changed(const S &state) {
+        const bool c = !valid || memcmp(&last, &state, sizeof(S)) != 0;
+        last = state; valid = true;
+        return c;
+    }
+    void invalidate() { valid = false; }
+private:
+    S last;
+    bool valid = false;
+};
+
+} // end namespace progressive
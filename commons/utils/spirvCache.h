@@ -0,0 +1,164 @@
+//------------------------------------------------------------------------------
+//  Copyright (c) 2025 Michele Morrone
+//  All rights reserved.
+//
+//  https://michelemorrone.eu - https://brutpitt.com
+//
+//  X: https://x.com/BrutPitt - GitHub: https://github.com/BrutPitt
+//
+//  direct mail: brutpitt(at)gmail.com - me(at)michelemorrone.eu
+//
+//  This software is distributed under the terms of the BSD 2-Clause license
+//------------------------------------------------------------------------------
+#pragma once
+#include <vulkan/vulkan.hpp>
+#include <shaderc/shaderc.hpp>
+
+#include <vector>
+#include <string>
+#include <cstring>
+#include <cstdio>
+#include <cstdint>
+#include <fstream>
+#include <iostream>
+#include <filesystem>
+
+#include "fileUtils.h"
+
+// On-disk SPIR-V cache for runtime shaderc compilation
+//
+//  compile(...) returns the SPIR-V of a GLSL source: it's read from
+//  SPIRV_CACHE_DIR if already compiled, otherwise it's compiled and stored
+//
+//  cache file name (content addressed): 64 bit FNV-1a hash of
+//      source + shader kind + optimization level + compiler build id +
+//      SPIR-V target version + cache format version
+//  compiler build id (SPIRV_CACHE_COMPILER_ID): the same source can give
+//      different SPIR-V with another shaderc/glslang build, while
+//      shaderc_get_spv_version() is only the SPIR-V version it targets
+//      set by CMake: Vulkan SDK version + glslang version (build_info.h)
+//      otherwise glslang version from <glslang/build_info.h> (if found)
+//      otherwise none: delete SPIRV_CACHE_DIR after a compiler upgrade
+//  cache file: header { magic, format, key, words, payload hash } + SPIR-V
+//      wrong/truncated header, key or payload hash ==> recompiled and rewritten
+//  write: fileUtils::writeAtomic (temporary file, then renamed)
+//
+//  -DSPIRV_CACHE_DIR=dir ==> cache dir (default: "spirvCache" in working dir)
+//  -DSPIRV_CACHE_DISABLED ==> always compile (as before)
+//  -DSPIRV_CACHE_COMPILER_ID="id" ==> compiler build id (see above)
+//------------------------------------------------------------------------------
+#ifndef SPIRV_CACHE_DIR
+    #define SPIRV_CACHE_DIR "spirvCache"
+#endif
+
+#if !defined(SPIRV_CACHE_COMPILER_ID)
+    #if defined(__has_include)
+        #if __has_include(<glslang/build_info.h>)
+            #include <glslang/build_info.h>
+            #define SPIRV_CACHE_STR2(x) #x
+            #define SPIRV_CACHE_STR(x) SPIRV_CACHE_STR2(x)
+            #define SPIRV_CACHE_COMPILER_ID "glslang-" SPIRV_CACHE_STR(GLSLANG_VERSION_MAJOR) "." \
+                                            SPIRV_CACHE_STR(GLSLANG_VERSION_MINOR) "." SPIRV_CACHE_STR(GLSLANG_VERSION_PATCH)
+        #endif
+    #endif
+    #if !defined(SPIRV_CACHE_COMPILER_ID)
+        #define SPIRV_CACHE_COMPILER_ID ""
+    #endif
+#endif
+
+namespace spirvCache {
+
+constexpr uint32_t cacheMagic   = 0x43565053;   // "SPVC"
+constexpr uint32_t cacheFormat  = 2;   // 2: compiler build id in the key
+constexpr uint32_t spirvMagic   = 0x07230203;
+
+struct cacheHeader {
+    uint32_t magic, format;
+    uint64_t key;
+    uint64_t words, hash;
+};
+
+inline uint64_t buildKey(const char *source, size_t size, shaderc_shader_kind kind, shaderc_optimization_level optLevel)
+{
+    unsigned int spvVersion = 0, spvRevision = 0;
+    shaderc_get_spv_version(&spvVersion, &spvRevision);
+    const uint32_t params[5] = { cacheFormat, uint32_t(kind), uint32_t(optLevel), spvVersion, spvRevision };
+    const char *compilerId = SPIRV_CACHE_COMPILER_ID;
+    return fileUtils::fnv1a(params, sizeof(params), fileUtils::fnv1a(compilerId, strlen(compilerId), fileUtils::fnv1a(source, size)));
+}
+
+inline std::string cacheFileName(const char *cacheDir, uint64_t key)
+{
+    char name[32];
+    snprintf(name, sizeof(name), "%016llx.spv", (unsigned long long) key);
+    return std::string(cacheDir) + "/" + name;
+}
+
+inline bool readCache(const std::string &fileName, uint64_t key, std::vector<uint32_t> &spirv)
+{
+    std::ifstream file(fileName, std::ios::binary);
+    if(!file.is_open()) return false;
+
+    cacheHeader header;
+    if(!file.read((char *) &header, sizeof(header))) return false;
+    if(header.magic != cacheMagic || header.format != cacheFormat || header.key != key || !header.words) return false;
+
+    spirv.resize(header.words);
+    if(!file.read((char *) spirv.data(), header.words * sizeof(uint32_t)) || file.peek() != EOF) return false;
+
+    return spirv[0] == spirvMagic && fileUtils::fnv1a(spirv.data(), spirv.size() * sizeof(uint32_t)) == header.hash;
+}
+
+inline void writeCache(const char *cacheDir, const std::string &fileName, uint64_t key, const std::vector<uint32_t> &spirv)
+{
+    std::error_code ec;
+    std::filesystem::create_directories(cacheDir, ec);
+
+    const size_t bytes = spirv.size() * sizeof(uint32_t);
+    const cacheHeader header { cacheMagic, cacheFormat, key, spirv.size(), fileUtils::fnv1a(spirv.data(), bytes) };
+    fileUtils::writeAtomic(fileName, &header, sizeof(header), spirv.data(), bytes);
+}
+
+// return SPIR-V code of GLSL "source" (empty vector on compilation error)
+inline std::vector<uint32_t> compile(shaderc::Compiler &compiler, const char *source, shaderc_shader_kind kind, const char *name,
+                                     shaderc_optimization_level optLevel, const char *cacheDir = SPIRV_CACHE_DIR)
+{
+    const size_t size = strlen(source);
+    std::vector<uint32_t> spirv;
+
+#if !defined(SPIRV_CACHE_DISABLED)
+    const uint64_t key = buildKey(source, size, kind, optLevel);
+    const std::string fileName = cacheFileName(cacheDir, key);
+    if(readCache(fileName, key, spirv)) return spirv;
+#endif
+
+    shaderc::CompileOptions options;
+    options.SetOptimizationLevel(optLevel);
+    const shaderc::SpvCompilationResult module = compiler.CompileGlslToSpv(source, size, kind, name, options);
+    if(module.GetCompilationStatus() != shaderc_compilation_status_success) { std::cerr << module.GetErrorMessage(); return {}; }
+
+    spirv.assign(module.cbegin(), module.cend());
+#if !defined(SPIRV_CACHE_DISABLED)
+    writeCache(cacheDir, fileName, key, spirv);
+#endif
+    return spirv;
+}
+
+// vertex and fragment shader modules from GLSL sources, through the cache
+//      optimization level: performance with NDEBUG, zero otherwise
+inline void createShaderModules(const vk::Device &device, const char *vertSource, const char *fragSource,
+                                vk::ShaderModule &vertModule, vk::ShaderModule &fragModule, const char *cacheDir = SPIRV_CACHE_DIR)
+{
+#ifdef NDEBUG
+    const shaderc_optimization_level optLevel = shaderc_optimization_level_performance;
+#else
+    const shaderc_optimization_level optLevel = shaderc_optimization_level_zero;
+#endif
+    shaderc::Compiler compiler;
+    const auto vertCode = compile(compiler, vertSource, shaderc_glsl_vertex_shader, "vertex shader", optLevel, cacheDir);
+    vertModule = device.createShaderModule(vk::ShaderModuleCreateInfo({}, vertCode.size()*sizeof(uint32_t), vertCode.data()));
+    const auto fragCode = compile(compiler, fragSource, shaderc_glsl_fragment_shader, "fragment shader", optLevel, cacheDir);
+    fragModule = device.createShaderModule(vk::ShaderModuleCreateInfo({}, fragCode.size()*sizeof(uint32_t), fragCode.data()));
+}
+
+} // end namespace spirvCache
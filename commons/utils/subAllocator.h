@@ -0,0 +1,106 @@
+//------------------------------------------------------------------------------
+//  Copyright (c) 2025 Michele Morrone
+//  All rights reserved.
+//
+//  https://michelemorrone.eu - https://brutpitt.com
+//
+//  X: https://x.com/BrutPitt - GitHub: https://github.com/BrutPitt
+//
+//  direct mail: brutpitt(at)gmail.com - me(at)michelemorrone.eu
+//
+//  This software is distributed under the terms of the BSD 2-Clause license
+//------------------------------------------------------------------------------
+#pragma once
+
+#include <cstdint>
+#include <cstring>
+#include <vector>
+#include <algorithm>
+
+// GPU-API agnostic helpers for device memory management
+//
+//  subAlloc::block  ==> ranges allocator inside one big memory block (e.g. a vk::DeviceMemory):
+//                       first fit on a sorted free list, with alignment, coalescing on free
+//                       (it handles only offsets: memory allocation/mapping is up to the caller)
+//  subAlloc::stridedCopy ==> scatter/gather of count elements of elemSize bytes between
+//                       two different strides (e.g. one attribute inside interleaved vertices)
+//
+//      subAlloc::block b(16 << 20);
+//      uint64_t offset;
+//      if(b.alloc(size, alignment, offset)) { ... bind at offset ...   b.free(offset, size); }
+//------------------------------------------------------------------------------
+namespace subAlloc {
+
+class block {
+public:
+    explicit block(uint64_t size = 0) : blockSize(size) { if(size) freeList.push_back({0, size}); }
+
+    // alignment: power of 2. Returns false if there is not a free range large enough
+    bool alloc(uint64_t size, uint64_t alignment, uint64_t &offset) {
+        if(!size) return false;
+        if(!alignment) alignment = 1;
+        for(size_t i = 0; i < freeList.size(); i++) {
+            range &r = freeList[i];
+            const uint64_t aligned = (r.offset + alignment - 1) & ~(alignment - 1);
+            if(aligned + size > r.offset + r.size) continue;
+
+            const range left { r.offset, aligned - r.offset }, right { aligned + size, r.offset + r.size - aligned - size };
+            if(left.size && right.size) { r = left; freeList.insert(freeList.begin() + i + 1, right); }
+            else if(left.size)  r = left;
+            else if(right.size) r = right;
+            else freeList.erase(freeList.begin() + i);
+
+            offset = aligned;
+            usedBytes += size; allocCount++;
+            return true;
+        }
+        return false;
+    }
+
+    // size: the same passed to alloc
+    void free(uint64_t offset, uint64_t size) {
+        auto it = std::lower_bound(freeList.begin(), freeList.end(), offset, [](const range &r, uint64_t o) { return r.offset < o; });
+        it = freeList.insert(it, {offset, size});
+        if(it + 1 != freeList.end() && it->offset + it->size == (it + 1)->offset) {     // merge with next
+            it->size += (it + 1)->size;
+            freeList.erase(it + 1);
+        }
+        if(it != freeList.begin() && (it - 1)->offset + (it - 1)->size == it->offset) { // merge with previous
+            (it - 1)->size += it->size;
+            freeList.erase(it);
+        }
+        usedBytes -= size; allocCount--;
+    }
+
+    uint64_t size()      const { return blockSize; }
+    uint64_t used()      const { return usedBytes; }
+    uint32_t allocs()    const { return allocCount; }
+    size_t   freeRanges() const { return freeList.size(); }   // fragmentation: 1 when empty (coalesced)
+    bool     empty()     const { return !allocCount; }
+
+    // largest free range: check for fragmentation
+    uint64_t largestFree() const {
+        uint64_t m = 0;
+        for(auto &r : freeList) m = std::max(m, r.size);
+        return m;
+    }
+
+private:
+    struct range { uint64_t offset, size; };
+    std::vector<range> freeList;    // sorted by offset, never adjacent
+    uint64_t blockSize, usedBytes = 0;
+    uint32_t allocCount = 0;
+};
+
+// copy count elements of elemSize bytes: src every srcStride bytes ==> dst every dstStride bytes
+// (stride == elemSize: packed) with both packed is a single memcpy
+inline void stridedCopy(void *dst, uint64_t dstStride, const void *src, uint64_t srcStride, uint64_t elemSize, uint64_t count)
+{
+    uint8_t *d = static_cast<uint8_t *>(dst);
+    const uint8_t *s = static_cast<const uint8_t *>(src);
+    if(dstStride == elemSize && srcStride == elemSize) { memcpy(d, s, elemSize * count); return; }
+    for(uint64_t i = 0; i < count; i++, d += dstStride, s += srcStride)
+        memcpy(d, s, elemSize);
+}
+
+} // namespace subAlloc
@@ -66,6 +66,55 @@ private:
     GLuint realDataSize, uBlockSize;
 };
 
+// Persistently mapped ring of instance data (SSBO): CPU writes a region while GPU reads the previous ones,
+// a fence for each region guards its reuse (glBufferStorage: no orphaning, no copy of glBufferSubData)
+class instanceRingClass {
+public:
+     instanceRingClass() { }
+    ~instanceRingClass() {
+        for(auto &f : fences) if(f) glDeleteSync(f);
+        if(sBuffer) glDeleteBuffers(1, &sBuffer);
+    }
+
+    void create(GLsizeiptr size, GLuint idx, int regions = 2) {
+        bindingLocation = idx;
+        realDataSize = size;
+        nRegions = regions < 1 ? 1 : (regions > maxRegions ? maxRegions : regions);
+
+        GLint offsetAlign(0);   // regions start aligned to bind them with glBindBufferRange
+        glGetIntegerv(GL_SHADER_STORAGE_BUFFER_OFFSET_ALIGNMENT, &offsetAlign);
+        regionSize = offsetAlign > 1 ? (size + offsetAlign - 1) / offsetAlign * offsetAlign : size;
+
+        const GLbitfield flags = GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT;
+        glCreateBuffers(1, &sBuffer);
+        glNamedBufferStorage(sBuffer, regionSize * nRegions, nullptr, flags);
+        mappedPtr = (uint8_t *) glMapNamedBufferRange(sBuffer, 0, regionSize * nRegions, flags);
+    }
+
+    // next region: wait (if need) GPU has done with it ==> return pointer where to write
+    void *beginRegion() {
+        current = (current + 1) % nRegions;
+        if(GLsync &f = fences[current]) {
+            while(glClientWaitSync(f, GL_SYNC_FLUSH_COMMANDS_BIT, 1000000) == GL_TIMEOUT_EXPIRED) ;
+            glDeleteSync(f);
+            f = nullptr;
+        }
+        return mappedPtr + current * regionSize;
+    }
+    // before draw calls that read the region
+    void bindRegion() { glBindBufferRange(GL_SHADER_STORAGE_BUFFER, bindingLocation, sBuffer, current * regionSize, realDataSize); }
+    // after draw calls that read the region
+    void endRegion() { fences[current] = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0); }
+
+private:
+    enum { maxRegions = 4 };
+    GLsync fences[maxRegions] {};
+    uint8_t *mappedPtr = nullptr;
+    GLuint sBuffer = 0, bindingLocation = 0;
+    GLsizeiptr realDataSize = 0, regionSize = 0;
+    int nRegions = 0, current = 0;
+};
+
 
 struct readShaderFile {
     readShaderFile(const std::string& fileName) {
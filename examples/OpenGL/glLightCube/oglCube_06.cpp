@@ -16,6 +16,7 @@
 #include <imgui/backends/imgui_impl_glfw.h>
 
 #include "utils/oglDebug.h"
+#include "utils/framePacer.h"
 #include "assets/cubePNC.h"
 
 /////////////////////////////////////////////////////////////////////////////
@@ -320,6 +321,9 @@ int main(int /* argc */, char ** /* argv */)    // necessary for SDLmain in Wind
     imguiGizmo::setPanModifier(vg::evSuperModifier);        // change KEY modifier: CTRL (default) ==> SUPER
     imguiGizmo::setDollyModifier(vg::evControlModifier);    // change KEY modifier: SHIFT (default) ==> CTRL
 
+    // frame pacer: vSync paces the frames ==> only measures and, when nothing moves, waits input events
+    framePacer pacer(0);
+
     // main render/draw loop
     while (!glfwWindowShouldClose(glfwWindow)) {
         glfwPollEvents();
@@ -449,6 +453,11 @@ int main(int /* argc */, char ** /* argv */)    // necessary for SDLmain in Wind
         ImGui_ImplOpenGL3_RenderDrawData(ImGui::GetDrawData());
 
         glfwSwapBuffers(glfwWindow);
+        pacer.endFrame();
+        if(pacer.shouldBlock(track.isIdleRotating() || ImGui::IsAnyItemActive())) {
+            glfwWaitEventsTimeout(pacer.getIdleTimeout());
+            pacer.resync();
+        }
     }
 
     // Cleanup ImGui
@@ -16,6 +16,7 @@
 #include <imgui/backends/imgui_impl_sdl2.h>
 
 #include "utils/oglDebug.h"
+#include "utils/framePacer.h"
 #include "assets/cubePNC.h"
 
 /////////////////////////////////////////////////////////////////////////////
@@ -323,6 +324,9 @@ int main(int /* argc */, char ** /* argv */)    // necessary for SDLmain in Wind
 
     SDL_Event event;
     bool done = false;
+    // frame pacer: vSync paces the frames ==> only measures and, when nothing moves, waits input events
+    framePacer pacer(0);
+
     // main render/draw loop
     while(!done) {
         while(SDL_PollEvent(&event)) {
@@ -460,6 +464,11 @@ int main(int /* argc */, char ** /* argv */)    // necessary for SDLmain in Wind
         ImGui_ImplOpenGL3_RenderDrawData(ImGui::GetDrawData());
 
         SDL_GL_SwapWindow(sdlWindow);
+        pacer.endFrame();
+        if(pacer.shouldBlock(track.isIdleRotating() || ImGui::IsAnyItemActive())) {
+            SDL_WaitEventTimeout(nullptr, int(pacer.getIdleTimeout() * 1000.0));    // event stays in queue
+            pacer.resync();
+        }
     }
 
     // Cleanup ImGui
@@ -16,7 +16,9 @@
 #include <imgui/backends/imgui_impl_glfw.h>
 
 #include "utils/oglDebug.h"
+#include "utils/framePacer.h"
 #include "assets/cubePNC.h"
+#include "utils/instanceData.h"
 
 /////////////////////////////////////////////////////////////////////////////
 // vGizmo3D:
@@ -37,7 +39,7 @@ const size_t nVertex = sizeof(cubePNC)/sizeof(cubePNC[0]);
 // Shaders & Vertex attributes
 GLuint program, vao, vaoBuffer;
 enum loc { vtxIdx = 0, nrmIdx, colIdx};     // shader locations
-enum bind { matIdx = 0, fgtIdx };
+enum bind { matIdx = 0, fgtIdx, instIdx };
 
 // I maintain this "old" matrices (from easy_examples) to better show the transformations steps and UBO assignments
 mat4 mvpMatrix, viewMatrix, projMatrix;
@@ -55,6 +57,11 @@ struct _uboMat {
 
 uniformBlocksClass ubo;
 
+// Many objects instances: VGIZMO_INSTANCES=count ==> count cubes, each with own orientation (commons/utils/instanceData.h)
+// builder writes directly in persistently mapped SSBO: double buffered (CPU writes frame N+1 while GPU draws frame N)
+instanceData::builder swarm;
+instanceRingClass instRing;
+
 /// imGuIZMO / vGizmo3D : declare global/static/member/..
 //~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
 vg::vGizmo3D track;     // using vGizmo3D global/static/member instead of specifics variables...
@@ -74,7 +81,7 @@ void draw()
 
     glBindVertexArray(vao);
 
-    glDrawArraysInstanced(GL_TRIANGLES, 0, nVertex, 2);   // now using instanced draw to "simulate" light
+    glDrawArraysInstanced(GL_TRIANGLES, 0, nVertex, 2 + swarm.size());   // now using instanced draw to "simulate" light (+ instances)
 
     glUseProgram(0);
 }
@@ -190,6 +197,9 @@ void initGL()
 
     ubo.create(sizeof(_uboMat), &uboMat, bind::matIdx );
 
+    if(const char *nInstances = getenv("VGIZMO_INSTANCES")) swarm.init(uint32_t(atoi(nInstances)));
+    if(swarm.size()) instRing.create(swarm.size() * sizeof(instanceData::gpuInstance), bind::instIdx, 2);
+
     glViewport(0, 0, width, height);
 
     glDisable(GL_BLEND);
@@ -326,6 +336,9 @@ int main(int /* argc */, char ** /* argv */)    // necessary for SDLmain in Wind
     imguiGizmo::setPanModifier(vg::evSuperModifier);        // change KEY modifier: CTRL (default) ==> SUPER
     imguiGizmo::setDollyModifier(vg::evControlModifier);    // change KEY modifier: SHIFT (default) ==> CTRL
 
+    // frame pacer: vSync paces the frames ==> only measures and, when nothing moves, waits input events
+    framePacer pacer(0);
+
     // main render/draw loop
     while (!glfwWindowShouldClose(glfwWindow)) {
         glfwPollEvents();
@@ -418,14 +431,26 @@ int main(int /* argc */, char ** /* argv */)    // necessary for SDLmain in Wind
 
         ubo.updateBufferData();
 
+    // instances: spin, follow vGizmo3D rotation & pan/dolly, written directly in the free region
+        if(swarm.size()) {
+            swarm.update(track.getRotation(), track.getPosition(), (instanceData::gpuInstance *) instRing.beginRegion());
+            instRing.bindRegion();
+        }
+
     // draw the cube, passing matrices to the vtx shader
         draw();
+        if(swarm.size()) instRing.endRegion();
 
     // ImGui Rendering
         ImGui::Render();
         ImGui_ImplOpenGL3_RenderDrawData(ImGui::GetDrawData());
 
         glfwSwapBuffers(glfwWindow);
+        pacer.endFrame();
+        if(pacer.shouldBlock(track.isIdleRotating() || ImGui::IsAnyItemActive() || swarm.size())) {   // instances always spin
+            glfwWaitEventsTimeout(pacer.getIdleTimeout());
+            pacer.resync();
+        }
     }
 
     // Cleanup ImGui
@@ -12,6 +12,8 @@
 //------------------------------------------------------------------------------
 #include <vulkan/vulkan.hpp>
 #include <shaderc/shaderc.hpp>
+#include "utils/spirvCache.h"
+#include "utils/framePacer.h"
 
 #include <iostream>
 #include <stdexcept>
@@ -131,6 +133,9 @@ void vkAppBase::initLogicalDevice()
 
     queueGraphics = logicalDevice.getQueue(graphQueueFamilyIdx, 0);
     queuePresent  = logicalDevice.getQueue(presentQueueFamilyIdx, 0);
+
+    memPool.init(physicalDevice, logicalDevice);
+    staging.init(memPool, logicalDevice, commandPool, queueGraphics);   // graphics queue supports also transfers
 }
 
 void vkAppBase::builSwapchain(vk::SwapchainKHR oldSwapChain)
@@ -161,11 +166,22 @@ void vkAppBase::buildImagesView()
 
 void vkAppBase::loadSpirVShaders()
 {
+#ifdef APP_EMBEDDED_SHADERS // cmake -DEMBED_SPIRV_SHADERS=ON: SPIR-V built by glslc -mfmt=c
+    static const uint32_t vertCode[] =
+        #include "vkLightCube.vert.spv.h"
+    ;
+    static const uint32_t fragCode[] =
+        #include "vkLightCube.frag.spv.h"
+    ;
+    vertShaderMod = logicalDevice.createShaderModule(vk::ShaderModuleCreateInfo({}, sizeof(vertCode), vertCode));
+    fragShaderMod = logicalDevice.createShaderModule(vk::ShaderModuleCreateInfo({}, sizeof(fragCode), fragCode));
+#else
     const auto vertCode = readFile(STRING(APP_SHADERS_DIR) "/" VERT_NAME);
     const auto fragCode = readFile(STRING(APP_SHADERS_DIR) "/" FRAG_NAME);
 
     vertShaderMod = logicalDevice.createShaderModule(vk::ShaderModuleCreateInfo({}, vertCode.size(), vertCode.data()));
     fragShaderMod = logicalDevice.createShaderModule(vk::ShaderModuleCreateInfo({}, fragCode.size(), fragCode.data()));
+#endif
 }
 
 // Load and compile shaders, like in WebGL/OpenGL
@@ -175,26 +191,8 @@ void vkAppBase::compileShaders()
     const auto vertCode = readFile(VERT_NAME);
     const auto fragCode = readFile(FRAG_NAME);
 
-    shaderc::Compiler compiler;
-    shaderc::CompileOptions options;
-#ifdef NDEBUG
-    options.SetOptimizationLevel(shaderc_optimization_level_performance);
-#else
-    options.SetOptimizationLevel(shaderc_optimization_level_zero);
-#endif
-    shaderc::SpvCompilationResult vertShaderModule = compiler.CompileGlslToSpv((char *)vertCode.data(), shaderc_glsl_vertex_shader, "vertex shader", options);
-    if(vertShaderModule.GetCompilationStatus() != shaderc_compilation_status_success) std::cerr << vertShaderModule.GetErrorMessage();
-
-    const auto vertShaderCode = std::vector<uint32_t>{ vertShaderModule.cbegin(), vertShaderModule.cend() };
-    const vk::ShaderModuleCreateInfo vertShaderCreateInfo({}, vertShaderCode.size()*sizeof(uint32_t), vertShaderCode.data());
-    vertShaderMod = logicalDevice.createShaderModule(vertShaderCreateInfo);
-
-    const shaderc::SpvCompilationResult fragShaderModule = compiler.CompileGlslToSpv((char *)fragCode.data(), shaderc_glsl_fragment_shader, "fragment shader", options);
-    if (fragShaderModule.GetCompilationStatus() != shaderc_compilation_status_success) std::cerr << fragShaderModule.GetErrorMessage();
-
-    const auto fragShaderCode = std::vector<uint32_t>{ fragShaderModule.cbegin(), fragShaderModule.cend() };
-    vk::ShaderModuleCreateInfo fragShaderCreateInfo({}, fragShaderCode.size()*sizeof(uint32_t), fragShaderCode.data());
-    fragShaderMod = logicalDevice.createShaderModule(fragShaderCreateInfo);
+    // SPIR-V from on-disk cache (SPIRV_CACHE_DIR): shaderc compiles only on first run or when source/options/compiler change
+    spirvCache::createShaderModules(logicalDevice, (const char *) vertCode.data(), (const char *) fragCode.data(), vertShaderMod, fragShaderMod);
 }
 
 void vkAppBase::buildRenderPass()
@@ -219,10 +217,32 @@ void vkAppBase::buildRenderPass()
     renderPass = logicalDevice.createRenderPass(vk::RenderPassCreateInfo({}, attachDescriptions, subpassDescription));
 }
 
+// pipeline cache from previous run (PIPELINE_CACHE_FILE), only if of same device and driver
+// VGIZMO_STARTUP_BENCH=cold ==> ignore it (empty cache, as first run)
 void vkAppBase::createPipelineCache()
 {
-    vk::PipelineCacheCreateInfo pipelineCacheCreateInfo;
-    pipelineCache = logicalDevice.createPipelineCache(pipelineCacheCreateInfo);
+    const vk::PhysicalDeviceProperties props = physicalDevice.getProperties();
+    pipelineCacheDevice = { props.vendorID, props.deviceID, props.driverVersion, props.apiVersion, {} };
+    memcpy(pipelineCacheDevice.uuid, props.pipelineCacheUUID.data(), sizeof(pipelineCacheDevice.uuid));
+
+    std::vector<uint8_t> blob;
+#if !defined(PIPELINE_CACHE_DISABLED)
+    const char *bench = getenv("VGIZMO_STARTUP_BENCH");
+    if(!(bench && !strcmp(bench, "cold"))) pipelineCacheLoaded = pipelineCacheFile::read(PIPELINE_CACHE_FILE, pipelineCacheDevice, blob);
+#endif
+    vk::PipelineCacheCreateInfo pipelineCacheCreateInfo({}, blob.size(), blob.data());
+    try { pipelineCache = logicalDevice.createPipelineCache(pipelineCacheCreateInfo); }
+    catch(vk::SystemError &e) {     // rejected blob: start empty
+        pipelineCacheLoaded = false;
+        pipelineCache = logicalDevice.createPipelineCache(vk::PipelineCacheCreateInfo());
+    }
+}
+
+void vkAppBase::savePipelineCache()
+{
+#if !defined(PIPELINE_CACHE_DISABLED)
+    if(pipelineReady) pipelineCacheFile::write(PIPELINE_CACHE_FILE, pipelineCacheDevice, logicalDevice.getPipelineCacheData(pipelineCache));
+#endif
 }
 
 void vkAppBase::buildGraphPipeline()
@@ -273,12 +293,17 @@ void vkAppBase::buildGraphPipeline()
 
 void vkAppBase::createSyncItems()
 {
-    fence.resize(minImageCount);
+    fence.resize(framesInFlight);
+    semaphoreImageAvailable.resize(framesInFlight);
     vk::SemaphoreCreateInfo semaphoreCreateInfo;
-    for(size_t i = 0; i < minImageCount; i++)
+    for(size_t i = 0; i < framesInFlight; i++) {
         fence[i] = logicalDevice.createFence({vk::FenceCreateFlagBits::eSignaled});
-    semaphoreImageAvailable = logicalDevice.createSemaphore(semaphoreCreateInfo);
-    semaphoreEndRendering   = logicalDevice.createSemaphore(semaphoreCreateInfo);
+        semaphoreImageAvailable[i] = logicalDevice.createSemaphore(semaphoreCreateInfo);
+    }
+    // signaled by submit, waited by present: reusable only when that image is acquired again
+    semaphoreEndRendering.resize(swapChainImages.size());
+    for(auto &s : semaphoreEndRendering) s = logicalDevice.createSemaphore(semaphoreCreateInfo);
+    frameIdx = 0;
 }
 
 void vkAppBase::buildFramebuffer()
@@ -297,40 +322,44 @@ void vkAppBase::buildFramebuffer()
 
 void vkAppBase::createDescriptorsPool()
 {
-    vk::DescriptorPoolSize poolSize(vk::DescriptorType::eUniformBuffer, 2);
-    descriptorPool = logicalDevice.createDescriptorPool(vk::DescriptorPoolCreateInfo({}, 1, poolSize));
+    const std::array poolSizes { vk::DescriptorPoolSize(vk::DescriptorType::eUniformBufferDynamic, 2),
+                                 vk::DescriptorPoolSize(vk::DescriptorType::eStorageBuffer, 1) };
+    descriptorPool = logicalDevice.createDescriptorPool(vk::DescriptorPoolCreateInfo({}, 1, poolSizes));
 }
 
 void vkAppBase::setupDescriptorsSetLayout()
 {
     std::vector<vk::DescriptorSetLayoutBinding> layoutBindings {
-        { 0, vk::DescriptorType::eUniformBuffer, 1, vk::ShaderStageFlagBits::eVertex  },
-        { 1, vk::DescriptorType::eUniformBuffer, 1, vk::ShaderStageFlagBits::eFragment} };
+        { 0, vk::DescriptorType::eUniformBufferDynamic, 1, vk::ShaderStageFlagBits::eVertex  },   // dynamic: ring slice of frame
+        { 1, vk::DescriptorType::eUniformBufferDynamic, 1, vk::ShaderStageFlagBits::eFragment},
+        { 2, vk::DescriptorType::eStorageBuffer, 1, vk::ShaderStageFlagBits::eVertex  } };
 
     descriptorSetLayout = logicalDevice.createDescriptorSetLayout(vk::DescriptorSetLayoutCreateInfo({}, layoutBindings));
     pipelineLayout      = logicalDevice.createPipelineLayout(     vk::PipelineLayoutCreateInfo({}, descriptorSetLayout));
 }
 
-void vkAppBase::updateDescriptorsSets(std::vector<bufferSet> &buffer)
+void vkAppBase::updateDescriptorsSets(std::vector<bufferSet> &buffer, bufferSet &storage)
 {
     descriptorSets = logicalDevice.allocateDescriptorSets(vk::DescriptorSetAllocateInfo(descriptorPool, descriptorSetLayout));
     std::vector<vk::DescriptorBufferInfo> desc;
     for( auto &b : buffer) desc.emplace_back(b.buffer, 0, b.bufferSize);
+    desc.emplace_back(storage.buffer, 0, VK_WHOLE_SIZE);  // all regions: selected by firstInstance
 
     vk::DescriptorSet descriptorSet = descriptorSets.front();
     std::vector<vk::WriteDescriptorSet> writeDescriptorSet {
-        {descriptorSet, 0, 0, 1, vk::DescriptorType::eUniformBuffer, {}, &desc[0]},
-        {descriptorSet, 1, 0, 1, vk::DescriptorType::eUniformBuffer, {}, &desc[1]} };
+        {descriptorSet, 0, 0, 1, vk::DescriptorType::eUniformBufferDynamic, {}, &desc[0]},
+        {descriptorSet, 1, 0, 1, vk::DescriptorType::eUniformBufferDynamic, {}, &desc[1]},
+        {descriptorSet, 2, 0, 1, vk::DescriptorType::eStorageBuffer, {}, &desc[2]} };
     logicalDevice.updateDescriptorSets(writeDescriptorSet, {});
 }
 
 void vkAppBase::buildCommandBuffers()
 {
-    commandBuffer.resize(swapChainImages.size());
+    commandBuffer.resize(framesInFlight);
     commandBuffer = logicalDevice.allocateCommandBuffers(vk::CommandBufferAllocateInfo(commandPool, vk::CommandBufferLevel::ePrimary, commandBuffer.size()));
 }
 
-void vkAppBase::setCommandBuffer(uint32_t currentFrame)
+void vkAppBase::setCommandBuffer(uint32_t currentFrame, vk::ArrayProxy<const uint32_t> const &dynamicOffsets)
 {
     std::array<vk::ClearValue, 2> clearValues;
     clearValues[0].color        = vk::ClearColorValue( 0.07f, 0.07f, 0.07f, 0.07f );
@@ -339,17 +368,20 @@ void vkAppBase::setCommandBuffer(uint32_t currentFrame)
     const vk::Rect2D scissor({ 0, 0 }, swapChainExtent);
     const vk::Viewport viewport(0.0f, 0.0f, swapChainExtent.width, swapChainExtent.height, 0.0f, 1.0f);
 
-    logicalDevice.resetCommandPool(commandPool);
-    commandBuffer[currentFrame].reset();
+    commandBuffer[currentFrame].reset();    // only this frame (pool eResetCommandBuffer): the other one can be in flight
     commandBuffer[currentFrame].begin(vk::CommandBufferBeginInfo());
     commandBuffer[currentFrame].beginRenderPass(vk::RenderPassBeginInfo(renderPass, scFrameBuffers[currentBufferIdx], rect, clearValues), vk::SubpassContents::eInline);
     commandBuffer[currentFrame].setViewport(0, 1, &viewport);
     commandBuffer[currentFrame].setScissor(0, 1, &scissor);
-    commandBuffer[currentFrame].bindPipeline(vk::PipelineBindPoint::eGraphics, pipeline);
-    commandBuffer[currentFrame].bindDescriptorSets(vk::PipelineBindPoint::eGraphics, pipelineLayout, 0, 1, &descriptorSets[0], 0, nullptr );
-    commandBuffer[currentFrame].bindVertexBuffers(0, vtxCubeData.buffer, {0 } );
-
-    commandBuffer[currentFrame].draw( 12 * 3, 2, 0, 0 );      //
+    if(isPipelineReady()) {     // until worker thread has built it: only clear and ImGui
+        commandBuffer[currentFrame].bindPipeline(vk::PipelineBindPoint::eGraphics, pipeline);
+        commandBuffer[currentFrame].bindDescriptorSets(vk::PipelineBindPoint::eGraphics, pipelineLayout, 0, descriptorSets[0], dynamicOffsets);
+        commandBuffer[currentFrame].bindVertexBuffers(0, vtxCubeData.buffer, {0 } );
+
+        commandBuffer[currentFrame].draw( 12 * 3, 2, 0, 0 );      //
+        // instances: firstInstance selects the region of this frame (shader reads inst[gl_InstanceIndex-2])
+        if(instanceCount) commandBuffer[currentFrame].draw( 12 * 3, instanceCount, 0, 2 + currentFrame * instanceCount );
+    }
 
     // ImGui: just before endRenderPass insert ImGui CommandBuffer data
     ImGui_ImplVulkan_RenderDrawData(ImGui::GetDrawData(), commandBuffer[currentFrame]);
@@ -429,19 +461,32 @@ void vkApp::setScene()
 
 void vkApp::draw()
 {
-    if(!prepareFrame()) { resizeWnd(); return; } // acquireNextImageKHR ==> resizeWnd on vk::OutOfDateKHRError
+    const uint32_t currentFrame = frameIdx; // frame in flight: differs from swapchain image index (currentBufferIdx)
 
-    const uint32_t currentFrame = currentBufferIdx; // used to differentiate in example: in reality they do not always coincide
-    
+    // wait GPU has done with this frame resources (command buffer, UBO slice, instances region), not with all
+    const auto waitStart = std::chrono::steady_clock::now();
     vk::detail::resultCheck(logicalDevice.waitForFences(1, &fence[currentFrame], VK_TRUE, std::numeric_limits<uint64_t>::max()), "waitForFences...");
+
+    if(!prepareFrame()) { resizeWnd(); return; } // acquireNextImageKHR ==> resizeWnd on vk::OutOfDateKHRError
+    frameWaitUs += std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - waitStart).count();
+
     vk::detail::resultCheck(logicalDevice.resetFences  (1, &fence[currentFrame]), "resetFences...");
 
-    setCommandBuffer(currentFrame);
+    // uniforms: rewrite this frame slice only if changed in last framesInFlight frames (persistently mapped, no map/unmap)
+    if(uboDirtySlices) {
+        for(auto &ubo : uboSceneMat) ubo.updateSlice(currentFrame);
+        uboDirtySlices--;
+    }
+
+    // instances: GPU has done with this frame region (fence) ==> spin & follow vGizmo3D, written directly in mapped memory
+    if(instanceCount) swarm.update(vgTrackball.getRotation(), vgTrackball.getPosition(), (instanceData::gpuInstance *) instBuffer.slicePtr(currentFrame));
+
+    setCommandBuffer(currentFrame, { uboSceneMat[0].sliceOffset(currentFrame), uboSceneMat[1].sliceOffset(currentFrame) });
 
     constexpr vk::PipelineStageFlags waitStageMask = vk::PipelineStageFlagBits::eColorAttachmentOutput;
-    const vk::SubmitInfo submitInfo(1, &semaphoreImageAvailable, &waitStageMask,
-                                    1, &commandBuffer[currentBufferIdx],
-                                    1, &semaphoreEndRendering);
+    const vk::SubmitInfo submitInfo(1, &semaphoreImageAvailable[currentFrame], &waitStageMask,
+                                    1, &commandBuffer[currentFrame],
+                                    1, &semaphoreEndRendering[currentBufferIdx]);
     queueGraphics.submit(submitInfo, fence[currentFrame]);
     submitFrame(); //presentKHR ==> resizeWnd on vk::OutOfDateKHRError and also on vk::Result::eSuboptimalKHR with stderr message
 }
@@ -456,6 +501,7 @@ void vkApp::resizeWnd()
 // vGizmo3D: is necessary to call when resize window/surface: re-calibrate drag rotation & auto-set mouse sensitivity
 //~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
     vgTrackball.viewportSize(width, height);
+    if(auto rec = framework.getInputTraceRecorder()) rec->viewport(width, height);
 }
 
 vec3 getLightPosFromQuat(quat &q, float centerDistance) { return (q * vec3(-1.0f, 0.0f, 0.0f)) * centerDistance ;}
@@ -471,6 +517,14 @@ void vkApp::run()
     // ImGui Vulkan initialization
     imguiInit();
 
+/// Input trace: VGIZMO_TRACE_RECORD=fileName ==> record vGizmo3D/ImGui input, to replay with examples/tools/tracePlayer
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+    inputTrace::recorder traceRecorder;
+    if(const char *traceFile = getenv("VGIZMO_TRACE_RECORD")) {
+        if(traceRecorder.open(traceFile)) framework.setInputTraceRecorder(&traceRecorder);
+        else std::cerr << "Input trace: can't create " << traceFile << std::endl;
+    }
+
 /// vGizmo3D (3D screen manipulator) initialize:
 /// set/associate mouse BUTTON IDs and KEY Modifier IDs to vGizmo3D functionalities
     framework.initVGizmo3D(vgTrackball);
@@ -484,6 +538,23 @@ void vkApp::run()
     imguiGizmo::setPanModifier(vg::evSuperModifier);        // change KEY modifier: CTRL (default) ==> SUPER
     imguiGizmo::setDollyModifier(vg::evControlModifier);    // change KEY modifier: SHIFT (default) ==> CTRL
 
+/// Frame pacing: with vSync the present (FIFO) paces the frames ==> framePacer only measures,
+/// w/o vSync 60 fps target. When nothing moves (no spin, no widget dragged) wait input events
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+    framePacer pacer(VSYNC_ENABLED ? 0 : 60);
+
+/// Frame stats: VGIZMO_FRAME_STATS=frames ==> every "frames" frames print CPU frame time and frames/s
+/// (e.g. software Vulkan: VK_ICD_FILENAMES=.../lvp_icd.x86_64.json, with VSYNC_ENABLED false to not be capped)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+    const char *statsEnv = getenv("VGIZMO_FRAME_STATS");
+    const uint64_t statsFrames = statsEnv ? strtoull(statsEnv, nullptr, 10) : 0;
+
+/// Startup: VGIZMO_STARTUP_BENCH=cold|warm ==> print time to first frame (only ImGui) and to first frame with the cube
+/// (pipeline built by worker thread: without/with the pipeline cache of a previous run), then exit
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+    const char *startupBench = getenv("VGIZMO_STARTUP_BENCH");
+    bool firstFrame = true, cubeShown = false;
+
     // Main render loop
     while(framework.pollEvents()) {     // glfwPollEvents | SDL_PollEvent ... with exit/quit check
 
@@ -497,6 +568,7 @@ void vkApp::run()
                             // It can be adjusted from setIdleRotSpeed(1.0) > more speed, < less
                             // It can be stopped by click on screen (without mouse movement)
         vgTrackball.idleSecond();  // also for "secondary" rotation
+        if(traceRecorder.isRecording()) traceRecorder.idle(true, true);
 
 
     // ImGUI: prepare ImGUI new frame
@@ -543,14 +615,41 @@ void vkApp::run()
         // light has orbit invariant around cube, of ray always length(lightPos), so...
         // uboFrag.lightPos = getLightPosFromQuat(vgTrackball.refSecondRot(),length(lightPos)) + vgTrackball.getPosition();
 
-        // update uniform buffers to GPU
-        for(auto &ubo : uboSceneMat) ubo.update();
+        // uniform buffers: mark all slices to update (in draw) only if something changed
+        if(uboMatTracker.changed(uboMat) | uboFragTracker.changed(uboFrag)) uboDirtySlices = framesInFlight;
 
     // ImGui: Render/draw
         ImGui::Render();
     // draw the cube, passing matrices to the vtx shader
         draw();             // Render framebuffer
+
+        if((startupBench || statsFrames) && !cubeShown) {
+            const auto now = std::chrono::steady_clock::now();
+            auto ms = [&](std::chrono::steady_clock::time_point t) { return std::chrono::duration<double, std::milli>(t - startTime).count(); };
+            if(firstFrame) std::cout << "first frame: " << ms(now) << " ms" << (pipelineReady ? "" : " (cube pipeline not yet ready)") << std::endl;
+            if(pipelineReady) {
+                std::cout << "first frame with cube: " << ms(now) << " ms - pipeline ready @ " << ms(pipelineReadyTime) << " ms (pipeline cache "
+                          << (pipelineCacheLoaded ? "warm" : "cold") << ")" << std::endl;
+                if(startupBench) break;
+            }
+        }
+        firstFrame = false; cubeShown = pipelineReady;
+
+        pacer.endFrame();
+        if(statsFrames && pacer.getStats().frames >= statsFrames) {
+            const framePacer::stats &st = pacer.getStats();
+            const double waitUs = frameWaitUs / st.frames;
+            std::cout << "frames " << st.frames << ":  CPU " << st.avgWorkUs - waitUs << " us  wait (fence + acquire) " << waitUs
+                      << " us  frame " << st.avgFrameUs << " us  " << 1e6 / st.avgFrameUs << " fps" << std::endl;
+            pacer.resetStats();
+            frameWaitUs = 0;
+        }
+        if(pacer.shouldBlock(vgTrackball.isIdleRotating() || ImGui::IsAnyItemActive() || instanceCount || !pipelineReady)) {   // instances always spin, cube not yet drawn
+            framework.waitEvents(pacer.getIdleTimeout());
+            pacer.resync();
+        }
     }
+    framework.setInputTraceRecorder(nullptr);   // traceRecorder: closed on exit of run()
 
     // Imgui cleanup
     imguiExit();
@@ -610,15 +709,31 @@ void vkApp::onInit()        // called from constructor @ startup
 {
     // specific App Vulkan Initializations
 
-    // Send cube Vertex to GPU
-    vtxCubeData.init(physicalDevice, logicalDevice, vk::BufferUsageFlagBits::eVertexBuffer);
-    vtxCubeData.copyToDevice();
+    // Send cube Vertex to GPU: static data in device local memory, through staging ring
+    vtxCubeData.init(memPool, logicalDevice, vk::BufferUsageFlagBits::eVertexBuffer, vk::MemoryPropertyFlagBits::eDeviceLocal);
+    staging.upload(vtxCubeData);
 
-    for(auto &ubo : uboSceneMat) { // uniform buffers for Vtx & Frag shaders
-        ubo.init(physicalDevice, logicalDevice, vk::BufferUsageFlagBits::eUniformBuffer);
-        ubo.update();
+    for(auto &ubo : uboSceneMat) { // uniform buffers for Vtx & Frag shaders: a slice for each frame in flight
+        ubo.initRing(memPool, logicalDevice, vk::BufferUsageFlagBits::eUniformBuffer, framesInFlight);
+        for(uint32_t i = 0; i < framesInFlight; i++) ubo.updateSlice(i);
     }
-    updateDescriptorsSets(uboSceneMat);
+    // instances storage buffer: a region for each frame in flight, contiguous (align = 1 instance) to select it by firstInstance
+    if(const char *nInstances = getenv("VGIZMO_INSTANCES")) swarm.init(uint32_t(atoi(nInstances)));
+    instanceCount = swarm.size();
+    instBuffer = bufferSet(nullptr, std::max(instanceCount, 1u) * sizeof(instanceData::gpuInstance));
+    instBuffer.initRing(memPool, logicalDevice, vk::BufferUsageFlagBits::eStorageBuffer, framesInFlight, sizeof(instanceData::gpuInstance));
+
+    staging.flush();    // transfers done before first frame
+
+/// Memory stats: VGIZMO_FRAME_STATS ==> device memory allocations (vkAllocateMemory) vs buffers
+///               VGIZMO_UPLOAD_BENCH=MB ==> staged upload throughput (contiguous and scatter) to device local memory
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+    if(getenv("VGIZMO_FRAME_STATS"))
+        std::cout << "device memory: " << memPool.deviceAllocations() << " allocations for " << memPool.subAllocations() << " buffers, "
+                  << memPool.usedBytes() << " bytes used" << std::endl;
+    if(const char *mb = getenv("VGIZMO_UPLOAD_BENCH")) uploadBench(uint32_t(atoi(mb)));
+
+    updateDescriptorsSets(uboSceneMat, instBuffer);
 
 /// vGizmo3D initialize:
 // Set Scene, vGizmo3D init and set starting rotations (primary & secondary)
@@ -639,6 +754,33 @@ void vkApp::onInit()        // called from constructor @ startup
     APP_REVERSE_AXES
 }
 
+void vkApp::uploadBench(uint32_t megaBytes)
+{
+    if(!megaBytes) return;
+    std::vector<uint8_t> data(size_t(megaBytes) << 20);
+    for(size_t i = 0; i < data.size(); i++) data[i] = uint8_t(i * 31);
+
+    bufferSet dst(data.data(), data.size());
+    dst.init(memPool, logicalDevice, vk::BufferUsageFlagBits::eVertexBuffer, vk::MemoryPropertyFlagBits::eDeviceLocal);
+
+    auto measure = [&](const char *name, vk::DeviceSize bytes, auto &&fn) {
+        const uint32_t submits = staging.submitCount();
+        const auto t0 = std::chrono::steady_clock::now();
+        fn();
+        staging.flush();
+        const double s = std::chrono::duration<double>(std::chrono::steady_clock::now() - t0).count();
+        std::cout << name << ": " << (bytes >> 20) << " MB in " << s * 1e3 << " ms ==> " << (bytes / (1024. * 1024.)) / s << " MB/s ("
+                  << staging.submitCount() - submits << " submits)" << std::endl;
+    };
+    measure("staged upload", data.size(), [&] { staging.upload(dst); });
+    // one float4 attribute for vertex (vertexPNC layout) overwritten in the same buffer
+    const uint32_t nElem = uint32_t(data.size() / vertexStride);
+    measure("staged scatter (16 bytes every vertex stride)", vk::DeviceSize(nElem) * 16, [&] { staging.scatter(dst.buffer, 0, vertexStride, data.data(), 16, nElem); });
+
+    std::cout << "device memory: " << memPool.deviceAllocations() << " allocations" << std::endl;
+    dst.destroy();
+}
+
 void vkApp::onExit()        // called from destructor @ exit
 {
     // wait GPU to idle before destroy resources
@@ -647,6 +789,7 @@ void vkApp::onExit()        // called from destructor @ exit
     // Vulkan App specific cleanup
     vtxCubeData.destroy();
     for(auto ubo : uboSceneMat) ubo.destroy();
+    instBuffer.destroy();
 }
 
 vkApp* vkApp::theMainApp = nullptr;
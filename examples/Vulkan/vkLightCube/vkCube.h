@@ -14,12 +14,18 @@ class vkApp;
 #define theApp vkApp::theMainApp
 
 #include <limits>
+#include <future>
+#include <chrono>
 
 #include "utils/dbgValidationLayer.h"
 #include "utils/framework.h"
 
 #include "assets/cubePNC.h"
 #include <imguizmo_quat.h>
+#include "utils/instanceData.h"
+#include "utils/progressiveRender.h"   // progressive::changeTracker
+#include "utils/subAllocator.h"
+#include "utils/pipelineCacheFile.h"
 
 #define VSYNC_ENABLED true         // true/false vSync on/off ==> pass from FiFo to Immediate presentation mode
 
@@ -29,65 +35,248 @@ static uint32_t height = 800, width = 1280;   //Default window size (for this ex
 VULKAN_HPP_INLINE uint32_t getImageCount( const uint32_t requiredCount, const uint32_t minImgCount, const uint32_t maxImgCount )
     { return maxImgCount > 0 ? std::min(std::max(requiredCount, minImgCount), maxImgCount) : std::max(requiredCount, minImgCount); }
 
-class bufferSet {
+// device memory sub-allocator: few big vk::DeviceMemory blocks (one or more for memory type), buffers are
+// carved out of them at the required alignment (subAlloc::block), host visible blocks are mapped once and forever
+// (only buffers: images (depth) have own memory, so bufferImageGranularity is not an issue here)
+class memoryPool {
 public:
-    bufferSet(void *buffer, vk::DeviceSize size) : bufferPtr(buffer), bufferSize(size) {}
+    struct allocation {
+        vk::DeviceMemory memory;
+        vk::DeviceSize offset = 0, size = 0;
+        uint8_t *mapped = nullptr;      // host visible memory: pointer to offset, nullptr otherwise
+        uint32_t blockIdx = ~0u;
+    };
+
+    void init(vk::PhysicalDevice &phyDev, vk::Device &device, vk::DeviceSize blockSize = 16 << 20) {
+        logicalDevice = &device; defaultBlockSize = blockSize;
+        memProperties = phyDev.getMemoryProperties();
+        limits = phyDev.getProperties().limits;
+    }
 
     void destroy() {
-        if(logicalDevice) {
-            logicalDevice->freeMemory(devMemBuffer);    // Free memory and destroy UBO
-            logicalDevice->destroy(buffer);
+        for(auto &b : blocks) {
+            assert(b.ranges.empty());   // all buffers destroyed
+            if(b.mapped) logicalDevice->unmapMemory(b.memory);
+            logicalDevice->freeMemory(b.memory);
         }
+        blocks.clear();
     }
 
-    uint32_t getMemoryTypeIdx(vk::PhysicalDevice &phyDev, const uint32_t typeFilter, const vk::MemoryPropertyFlags properties) {
-        const vk::PhysicalDeviceMemoryProperties memProperties = phyDev.getMemoryProperties();
+    uint32_t getMemoryTypeIdx(const uint32_t typeFilter, const vk::MemoryPropertyFlags properties) const {
         for (uint32_t i = 0; i < memProperties.memoryTypeCount; i++)
             if ((typeFilter & (1 << i)) && (memProperties.memoryTypes[i].propertyFlags & properties) == properties)  return i;
         throw std::runtime_error("failed suitable memoType...");
     }
 
-    void init(vk::PhysicalDevice &phyDev, vk::Device &device, vk::BufferUsageFlagBits buffFlags,
-                                                              vk::MemoryPropertyFlags memFlags = vk::MemoryPropertyFlagBits::eHostVisible |
-                                                                                                 vk::MemoryPropertyFlagBits::eHostCoherent) {
-        logicalDevice = &device;
-        buffer = device.createBuffer(vk::BufferCreateInfo({} , bufferSize, buffFlags));
+    allocation alloc(const vk::MemoryRequirements &memReq, vk::MemoryPropertyFlags memFlags) {
+        assert(logicalDevice!=nullptr);
+        const uint32_t typeIdx = getMemoryTypeIdx(memReq.memoryTypeBits, memFlags);
+        allocation a;
+        a.size = memReq.size;
+        for(uint32_t i = 0; i < blocks.size(); i++)
+            if(blocks[i].typeIdx == typeIdx && blocks[i].ranges.alloc(memReq.size, memReq.alignment, a.offset)) return fill(a, i);
+
+        // new block: default size or larger for a big buffer
+        memBlock b { {}, typeIdx, nullptr, subAlloc::block(std::max(defaultBlockSize, memReq.size)) };
+        b.memory = logicalDevice->allocateMemory(vk::MemoryAllocateInfo(b.ranges.size(), typeIdx));
+        if(memProperties.memoryTypes[typeIdx].propertyFlags & vk::MemoryPropertyFlagBits::eHostVisible)
+            b.mapped = static_cast<uint8_t *>(logicalDevice->mapMemory(b.memory, 0, VK_WHOLE_SIZE));
+        b.ranges.alloc(memReq.size, memReq.alignment, a.offset);
+        blocks.push_back(b);
+        deviceAllocs++;
+        return fill(a, uint32_t(blocks.size() - 1));
+    }
+
+    void free(allocation &a) {
+        if(a.blockIdx == ~0u) return;
+        blocks[a.blockIdx].ranges.free(a.offset, a.size);   // block stays: reused by next alloc
+        a = allocation();
+        subAllocs--;
+    }
 
-        const vk::MemoryRequirements memReq = device.getBufferMemoryRequirements(buffer);
-        const vk::MemoryAllocateInfo allocInfo(memReq.size, getMemoryTypeIdx(phyDev, memReq.memoryTypeBits, memFlags));
-        devMemBuffer = device.allocateMemory(allocInfo);
+    vk::PhysicalDeviceLimits const &getLimits() const { return limits; }
+    uint32_t deviceAllocations() const { return deviceAllocs; }     // vkAllocateMemory calls
+    uint32_t subAllocations()    const { return subAllocs; }        // live buffers
+    vk::DeviceSize usedBytes()   const { vk::DeviceSize n = 0; for(auto &b : blocks) n += b.ranges.used(); return n; }
 
-        device.bindBufferMemory(buffer, devMemBuffer, 0);
+private:
+    allocation &fill(allocation &a, uint32_t i) {
+        a.blockIdx = i; a.memory = blocks[i].memory;
+        a.mapped = blocks[i].mapped ? blocks[i].mapped + a.offset : nullptr;
+        subAllocs++;
+        return a;
     }
 
-    void update() const {
-        assert(logicalDevice!=nullptr);
+    struct memBlock {
+        vk::DeviceMemory memory;
+        uint32_t typeIdx;
+        uint8_t *mapped;
+        subAlloc::block ranges;
+    };
+    std::vector<memBlock> blocks;
+    vk::PhysicalDeviceMemoryProperties memProperties;
+    vk::PhysicalDeviceLimits limits;
+    vk::DeviceSize defaultBlockSize = 0;
+    uint32_t deviceAllocs = 0, subAllocs = 0;
+    vk::Device *logicalDevice = nullptr;
+};
+
+class bufferSet {
+public:
+    bufferSet(void *buffer, vk::DeviceSize size) : bufferPtr(buffer), bufferSize(size), sliceSize(size) {}
 
-        void *pData = logicalDevice->mapMemory(devMemBuffer, 0, bufferSize, vk::MemoryMapFlags(0));
-        memcpy(pData, bufferPtr, bufferSize);
-        logicalDevice->unmapMemory(devMemBuffer); // Unmap after data has been copied
+    void destroy() {
+        if(logicalDevice) {
+            logicalDevice->destroy(buffer);             // destroy buffer and return its range to the pool
+            pool->free(memAlloc);
+            logicalDevice = nullptr;
+        }
     }
 
-    void copyToDevice(vk::DeviceSize stride = 0 ) {
-        assert(logicalDevice!=nullptr);
-        uint8_t * deviceData = static_cast<uint8_t *>( logicalDevice->mapMemory( devMemBuffer, 0, bufferSize ) );
-        if(!stride) memcpy( deviceData, bufferPtr, bufferSize);
-        else { // TODO: not yet tested!!!!! (not used here)
-            assert(0);
-            vk::DeviceSize size = bufferSize / stride;
-            for(size_t i = 0; i < bufferSize; i+=stride) {
-                memcpy( deviceData, &((uint8_t *)bufferPtr)[i], size );
-                deviceData += stride;
-            }
-      }
-      logicalDevice->unmapMemory( devMemBuffer );
+    // memFlags eDeviceLocal (static data) ==> eTransferDst is added: write it with stagingRing::upload
+    void init(memoryPool &memPool, vk::Device &device, vk::BufferUsageFlags buffFlags,
+                                                       vk::MemoryPropertyFlags memFlags = vk::MemoryPropertyFlagBits::eHostVisible |
+                                                                                          vk::MemoryPropertyFlagBits::eHostCoherent) {
+        logicalDevice = &device; pool = &memPool;
+        if(!(memFlags & vk::MemoryPropertyFlagBits::eHostVisible)) buffFlags |= vk::BufferUsageFlagBits::eTransferDst;
+        buffer = device.createBuffer(vk::BufferCreateInfo({} , sliceSize * slices, buffFlags));
+
+        memAlloc = memPool.alloc(device.getBufferMemoryRequirements(buffer), memFlags);
+        device.bindBufferMemory(buffer, memAlloc.memory, memAlloc.offset);
     }
 
+    // ring of nSlices copies (one for frame in flight) persistently mapped: slice i is rewritten only when
+    // GPU has done with frame i (fence), no map/unmap for update, descriptor uses dynamic offset sliceOffset(i)
+    // align: slices alignment, 0 ==> minUniformBufferOffsetAlignment
+    void initRing(memoryPool &memPool, vk::Device &device, vk::BufferUsageFlags buffFlags, uint32_t nSlices, vk::DeviceSize align = 0) {
+        if(!align) align = memPool.getLimits().minUniformBufferOffsetAlignment;
+        sliceSize = (bufferSize + align - 1) / align * align;
+        slices = nSlices;
+        init(memPool, device, buffFlags);
+    }
+    void updateSlice(uint32_t i) const { assert(memAlloc.mapped && i < slices); memcpy(memAlloc.mapped + i * sliceSize, bufferPtr, bufferSize); }
+    void *slicePtr(uint32_t i) const { assert(memAlloc.mapped && i < slices); return memAlloc.mapped + i * sliceSize; }
+    uint32_t sliceOffset(uint32_t i) const { return uint32_t(i * sliceSize); }
+
+    // host visible memory (pool blocks are persistently mapped): direct copy
+    void update() const { updateSlice(0); }
+
+    // host visible memory: copy whole bufferPtr, or scatter count elements of elemSize bytes, packed in src,
+    // every dstStride bytes from dstOffset (e.g. only one attribute of interleaved vertices)
+    // device local memory: use stagingRing::upload / stagingRing::scatter
+    void copyToDevice() const { updateSlice(0); }
+    void copyToDevice(const void *src, vk::DeviceSize elemSize, uint32_t count, vk::DeviceSize dstOffset, vk::DeviceSize dstStride) const {
+        assert(memAlloc.mapped && dstOffset + (count ? (count - 1) * dstStride + elemSize : 0) <= sliceSize * slices);
+        subAlloc::stridedCopy(memAlloc.mapped + dstOffset, dstStride, src, elemSize, elemSize, count);
+    }
+
+    bool isHostVisible() const { return memAlloc.mapped != nullptr; }
+
     void *bufferPtr;
     vk::DeviceSize bufferSize;
     vk::Buffer buffer;
 private:
-    vk::DeviceMemory devMemBuffer;
+    vk::DeviceSize sliceSize;
+    uint32_t slices = 1;
+    memoryPool::allocation memAlloc;
+    memoryPool *pool = nullptr;
+    vk::Device *logicalDevice = nullptr;
+};
+
+// staging ring: host visible buffer where data are copied and transfer commands (vkCmdCopyBuffer) recorded
+// toward device local buffers. When it is full (or on flush) commands are submitted and waited by fence, then
+// the ring restarts from the beginning. Used for static data @ init/load: no per-frame uploads
+class stagingRing {
+public:
+    void init(memoryPool &memPool, vk::Device &device, vk::CommandPool cmdPool, vk::Queue transferQueue, vk::DeviceSize size = 4 << 20) {
+        logicalDevice = &device; queue = transferQueue; commandPool = cmdPool;
+        ring = bufferSet(nullptr, size);
+        ring.init(memPool, device, vk::BufferUsageFlagBits::eTransferSrc);
+        cmd = device.allocateCommandBuffers(vk::CommandBufferAllocateInfo(cmdPool, vk::CommandBufferLevel::ePrimary, 1)).front();
+        fence = device.createFence({});
+    }
+
+    void destroy() {
+        if(!logicalDevice) return;
+        flush();
+        logicalDevice->destroy(fence);
+        logicalDevice->freeCommandBuffers(commandPool, cmd);
+        ring.destroy();
+        logicalDevice = nullptr;
+    }
+
+    // whole dst.bufferPtr ==> dst (device local), in chunks if larger than ring
+    void upload(bufferSet &dst) { copy(dst.buffer, 0, dst.bufferPtr, dst.bufferSize); }
+
+    void copy(vk::Buffer dst, vk::DeviceSize dstOffset, const void *src, vk::DeviceSize size) {
+        const uint8_t *s = static_cast<const uint8_t *>(src);
+        while(size) {
+            const vk::DeviceSize chunk = std::min(size, reserve(std::min(size, ring.bufferSize)));
+            memcpy((uint8_t *) ring.slicePtr(0) + head, s, chunk);
+            regions.emplace_back(head, dstOffset, chunk);
+            record(dst);
+            head += chunk; s += chunk; dstOffset += chunk; size -= chunk;
+        }
+    }
+
+    // count elements of elemSize bytes, packed in src ==> dst every dstStride bytes from dstOffset:
+    // data packed in the ring and one copy region for element
+    void scatter(vk::Buffer dst, vk::DeviceSize dstOffset, vk::DeviceSize dstStride, const void *src, vk::DeviceSize elemSize, uint32_t count) {
+        assert(elemSize <= ring.bufferSize);
+        const uint8_t *s = static_cast<const uint8_t *>(src);
+        const uint32_t perChunk = uint32_t(ring.bufferSize / elemSize);
+        while(count) {
+            const uint32_t n = std::min(count, perChunk);
+            reserve(n * elemSize);
+            memcpy((uint8_t *) ring.slicePtr(0) + head, s, n * elemSize);
+            for(uint32_t i = 0; i < n; i++) regions.emplace_back(head + i * elemSize, dstOffset + i * dstStride, elemSize);
+            record(dst);
+            head += n * elemSize; s += n * elemSize; dstOffset += n * dstStride; count -= n;
+        }
+    }
+
+    // submit recorded transfers and wait: after it destination buffers are ready for vertex/uniform/storage reads
+    void flush() {
+        if(!recording) return;
+        const vk::MemoryBarrier barrier(vk::AccessFlagBits::eTransferWrite, vk::AccessFlagBits::eVertexAttributeRead | vk::AccessFlagBits::eIndexRead |
+                                                                           vk::AccessFlagBits::eUniformRead | vk::AccessFlagBits::eShaderRead);
+        cmd.pipelineBarrier(vk::PipelineStageFlagBits::eTransfer, vk::PipelineStageFlagBits::eVertexInput | vk::PipelineStageFlagBits::eVertexShader |
+                                                                  vk::PipelineStageFlagBits::eFragmentShader, {}, barrier, {}, {});
+        cmd.end();
+        queue.submit(vk::SubmitInfo(0, nullptr, nullptr, 1, &cmd), fence);
+        vk::detail::resultCheck(logicalDevice->waitForFences(1, &fence, VK_TRUE, std::numeric_limits<uint64_t>::max()), "waitForFences...");
+        vk::detail::resultCheck(logicalDevice->resetFences(1, &fence), "resetFences...");
+        recording = false; head = 0;
+        submits++;
+    }
+
+    uint64_t bytesUploaded() const { return bytes; }
+    uint32_t submitCount() const { return submits; }
+
+private:
+    // free space in ring (at least min bytes): flush and restart if not enough
+    vk::DeviceSize reserve(vk::DeviceSize min) {
+        head = (head + 15) & ~vk::DeviceSize(15);   // keep copies 16 bytes aligned
+        if(head + min > ring.bufferSize) flush();
+        if(!recording) { cmd.begin(vk::CommandBufferBeginInfo(vk::CommandBufferUsageFlagBits::eOneTimeSubmit)); recording = true; }
+        return ring.bufferSize - head;
+    }
+    void record(vk::Buffer dst) {
+        cmd.copyBuffer(ring.buffer, dst, regions);
+        for(auto &r : regions) bytes += r.size;
+        regions.clear();
+    }
+
+    bufferSet ring { nullptr, 0 };
+    std::vector<vk::BufferCopy> regions;
+    vk::DeviceSize head = 0;
+    vk::CommandBuffer cmd;
+    vk::CommandPool commandPool;
+    vk::Fence fence;
+    vk::Queue queue;
+    bool recording = false;
+    uint64_t bytes = 0;
+    uint32_t submits = 0;
     vk::Device *logicalDevice = nullptr;
 };
 
@@ -165,11 +354,24 @@ protected:
         buildSwapChainComponents();
         buildRenderPass();
         createPipelineCache();
-        //compileShaders();;
-        loadSpirVShaders();
         createDescriptorsPool();
         setupDescriptorsSetLayout();
-        buildGraphPipeline();
+        // shaders & pipeline built in a worker thread: window and ImGui show first frames meanwhile (cube drawn when ready)
+        pipelineBuild = std::async(std::launch::async, [this] {
+            //compileShaders();;
+            loadSpirVShaders();
+            buildGraphPipeline();
+            pipelineReadyTime = std::chrono::steady_clock::now();
+        });
+    }
+
+    // poll worker thread: rethrows here its exceptions
+    bool isPipelineReady() {
+        if(!pipelineReady && pipelineBuild.valid() && pipelineBuild.wait_for(std::chrono::seconds(0)) == std::future_status::ready) {
+            pipelineBuild.get();
+            pipelineReady = true;
+        }
+        return pipelineReady;
     }
 
     void buildSwapChainComponents() {
@@ -192,21 +394,22 @@ protected:
     void buildDepthBuffer();
     void buildRenderPass();
     void createPipelineCache();
+    void savePipelineCache();
     void buildGraphPipeline();
     void createSyncItems();
     void buildFramebuffer();
     void createDescriptorsPool();
     void setupDescriptorsSetLayout();
-    void updateDescriptorsSets(std::vector<bufferSet> &buffer);
+    void updateDescriptorsSets(std::vector<bufferSet> &buffer, bufferSet &storage);
     void buildCommandBuffers();
-    void setCommandBuffer(uint32_t currentFrame);
+    void setCommandBuffer(uint32_t currentFrame, vk::ArrayProxy<const uint32_t> const &dynamicOffsets);
     void rebuildAllSwapchain();
     virtual void resizeWnd() = 0;
 
     bool prepareFrame() { // return ImageIndex
         vk::ResultValue<uint32_t> retVal {{}, {}};
 
-        try { retVal = logicalDevice.acquireNextImageKHR(swapChain, std::numeric_limits<uint64_t>::max(), semaphoreImageAvailable, {}); }
+        try { retVal = logicalDevice.acquireNextImageKHR(swapChain, std::numeric_limits<uint64_t>::max(), semaphoreImageAvailable[frameIdx], {}); }
         catch(vk::OutOfDateKHRError &e) { return false; }
         VK_CATCH("failed on NextImage...")
         if(retVal.result != vk::Result::eSuccess && retVal.result != vk::Result::eSuboptimalKHR) {
@@ -217,13 +420,12 @@ protected:
     }
 
     void submitFrame() {
-        const vk::PresentInfoKHR presentInfo(1, &semaphoreEndRendering, 1, &swapChain, &currentBufferIdx);
+        const vk::PresentInfoKHR presentInfo(1, &semaphoreEndRendering[currentBufferIdx], 1, &swapChain, &currentBufferIdx);
+        frameIdx = (frameIdx + 1) % framesInFlight;     // no wait: next frame is recorded while GPU works on this one
 
         vk::Result present;
         try { present = queuePresent.presentKHR(presentInfo); } catch (vk::OutOfDateKHRError& err) { resizeWnd(); return; } catch (vk::SystemError& err) { throw std::runtime_error("failed presentQueue..."); }
         if(present == vk::Result::eSuboptimalKHR) { std::cerr << "Suboptimal present!" << std::endl; resizeWnd(); return; }
-        // wait present is done
-        queuePresent.waitIdle();
     }
 
     void destroySwapChainComponents()
@@ -234,11 +436,12 @@ protected:
 
         // Sync objects
         for(auto f : fence) logicalDevice.destroy(f);                 //
-        logicalDevice.destroy(semaphoreEndRendering);
-        logicalDevice.destroy(semaphoreImageAvailable);
+        for(auto s : semaphoreEndRendering)   logicalDevice.destroy(s);
+        for(auto s : semaphoreImageAvailable) logicalDevice.destroy(s);
     }
 
     ~vkAppBase() {
+        if(pipelineBuild.valid()) pipelineBuild.wait();   // worker thread still building (quit before first frame)
         // wait GPU to idle before destroy resources
         logicalDevice.waitIdle();
         // If not used "Unique" objects declaration, need to destroy them
@@ -246,11 +449,15 @@ protected:
         destroySwapChainComponents();
         logicalDevice.destroySwapchainKHR(swapChain);
         // Command and Frame Buffers
+        savePipelineCache();
         logicalDevice.destroyPipelineCache(pipelineCache);
         logicalDevice.destroyDescriptorPool(descriptorPool);
         logicalDevice.destroyDescriptorSetLayout(descriptorSetLayout);
         logicalDevice.destroyPipeline(pipeline);
         logicalDevice.destroyPipelineLayout(pipelineLayout);
+        // device memory blocks (all buffers are already destroyed)
+        staging.destroy();
+        memPool.destroy();
 
         logicalDevice.destroy();    // logical device
 
@@ -282,6 +489,12 @@ protected:
     vk::Pipeline pipeline;
     vk::PipelineLayout pipelineLayout;
     vk::PipelineCache pipelineCache;
+    pipelineCacheFile::deviceId pipelineCacheDevice;
+    bool pipelineCacheLoaded = false;
+    std::future<void> pipelineBuild;    // worker thread: shaders + graphics pipeline
+    bool pipelineReady = false;
+    const std::chrono::steady_clock::time_point startTime = std::chrono::steady_clock::now();
+    std::chrono::steady_clock::time_point pipelineReadyTime;
     vk::SwapchainKHR swapChain;
     std::vector<vk::Image> swapChainImages;
     vk::DescriptorSetLayout descriptorSetLayout;
@@ -291,7 +504,11 @@ protected:
     std::vector<vk::CommandBuffer> commandBuffer;
     std::vector<vk::ImageView> scImageView;     //SwapChainIV
     std::vector<vk::Framebuffer> scFrameBuffers; //SwapChainFB
-    vk::Semaphore semaphoreImageAvailable {}, semaphoreEndRendering {};
+    // frames in flight: CPU records frame N+1 while GPU renders frame N
+    // for each frame: fence, imageAvailable semaphore, command buffer, UBO slice (endRendering: for each swapchain image)
+    static constexpr uint32_t framesInFlight = 2;
+    uint32_t frameIdx {0};
+    std::vector<vk::Semaphore> semaphoreImageAvailable, semaphoreEndRendering;
     std::vector<vk::Fence> fence;
     depthBufferSet depthBuffer;
 
@@ -309,7 +526,10 @@ protected:
     uint32_t graphQueueFamilyIdx;
     uint32_t currentBufferIdx {0};
 
+    memoryPool memPool;     // all buffers are sub-allocated from its blocks
+    stagingRing staging;    // static data ==> device local memory
     bufferSet vtxCubeData { (void *) cubePNC, sizeof(cubePNC) };
+    uint32_t instanceCount {0};     // many objects instances drawn after cube & light (0 = none)
 };
 
 // Vulkan App
@@ -327,6 +547,7 @@ private:
 
     void onInit();
     void onExit();
+    void uploadBench(uint32_t megaBytes);
 
     void imguiInit();
     void imguiExit();
@@ -360,6 +581,18 @@ private:
     std::vector<bufferSet> uboSceneMat {{ (void *) &uboMat,  sizeof(_uboMat)  },
                                         { (void *) &uboFrag, sizeof(_uboFrag) } };
 
+    // Many objects instances: VGIZMO_INSTANCES=count ==> count cubes, each with own orientation (commons/utils/instanceData.h)
+    // storage buffer persistently mapped, a region for each frame in flight (guarded by its fence): builder writes directly there
+    instanceData::builder swarm;
+    bufferSet instBuffer { nullptr, 0 };    // always present: binding 2 is statically used by vertex shader
+
+    // uniforms are rewritten only when changed (vGizmo3D moves, widgets, resize): a slice for frame ==> framesInFlight updates
+    progressive::changeTracker<_uboMat>  uboMatTracker;
+    progressive::changeTracker<_uboFrag> uboFragTracker;
+    uint32_t uboDirtySlices = 0;
+
+    double frameWaitUs = 0;     // time blocked (fence + acquire) since last stats: CPU frame time = work - wait
+
     /// imGuIZMO / vGizmo3D : declare global/static/member/..
     //~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
     vg::vGizmo3D vgTrackball; // using vGizmo3D global/static/member instead of specifics variables...
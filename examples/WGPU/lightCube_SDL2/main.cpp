@@ -11,6 +11,7 @@
 //  This software is distributed under the terms of the BSD 2-Clause license
 //------------------------------------------------------------------------------
 #include <cstdio>
+#include <cstdlib>
 #include <cassert>
 #include <cfloat>
 /////////////////////////////////////////////////////////////////////////////
@@ -36,6 +37,8 @@
 #include <webgpu/webgpu_cpp.h>
 
 #include "assets/cubePNC.h"
+#include "utils/framePacer.h"
+#include "utils/progressiveRender.h"   // progressive::changeTracker
 
 void renderWidgets(vg::vGizmo3D &track, vec3& vLight, int width, int height);
 
@@ -87,6 +90,21 @@ wgpu::SurfaceConfiguration  surfaceConfig;
 wgpu::RenderPipeline pipeline;
 wgpu::Buffer ubo;
 wgpu::BindGroupLayout bindGroupLayout;
+wgpu::BindGroup bindGroup;          // created once: uniform slot selected by dynamic offset
+
+// Uniforms: multi-slot buffer, rewritten (in next slot) only when changed (vGizmo3D moves, widgets, resize)
+constexpr uint32_t uboSlots = 3;
+constexpr uint32_t uboSlotStride = (sizeof(uboData) + 255) & ~255u;  // minUniformBufferOffsetAlignment: 256 (max allowed)
+uint32_t uboSlot = 0;
+progressive::changeTracker<uboData> uboTracker;
+
+// Static draws (cube and light) pre-recorded in a RenderBundle for each uniform slot (dynamic offset is recorded)
+// and replayed every frame: VGIZMO_NO_BUNDLES=1 ==> encoded every frame (as before), to compare
+std::array<wgpu::RenderBundle, uboSlots> sceneBundles;
+bool useBundles = true;
+
+// Frame stats (VGIZMO_FRAME_STATS=frames): CPU time to encode the frame, queue writes
+struct { double encodeUs = 0; uint64_t writes = 0, writeBytes = 0; } frameStats;
 
 wgpu::Buffer vertexBuffer;
 wgpu::Texture     depthTexture;
@@ -336,9 +354,9 @@ void initRenderPipeline()
     vertexBufferLayout.attributeCount = std::size( attributes );
     vertexBufferLayout.attributes     = attributes.data();
 
-    // Uniform Buffer
+    // Uniform Buffer: uboSlots slots
     wgpu::BufferDescriptor bufferDesc;
-    bufferDesc.size = sizeof(uboData);
+    bufferDesc.size = uboSlots * uboSlotStride;
     bufferDesc.usage = wgpu::BufferUsage::CopyDst | wgpu::BufferUsage::Uniform;
     ubo = device.CreateBuffer(&bufferDesc);
 
@@ -373,6 +391,7 @@ void initRenderPipeline()
     bindGroupLayoutEntry.binding               = 0;
     bindGroupLayoutEntry.visibility            = wgpu::ShaderStage::Vertex | wgpu::ShaderStage::Fragment;
     bindGroupLayoutEntry.buffer.type           = wgpu::BufferBindingType::Uniform;
+    bindGroupLayoutEntry.buffer.hasDynamicOffset = true;
     bindGroupLayoutEntry.buffer.minBindingSize = sizeof(uboData);
 
     // BindGroupLayout
@@ -390,6 +409,7 @@ void initRenderPipeline()
     wgpu::RenderPipelineDescriptor pipelineDesc;
     pipelineDesc.layout = device.CreatePipelineLayout(&layoutDesc);     // wgpu::pipelineLayout
     pipelineDesc.vertex.module = module;
+    pipelineDesc.vertex.entryPoint = "vs";                              // module has also "vsInstances" entry point
     pipelineDesc.vertex.bufferCount = 1;
     pipelineDesc.vertex.buffers = &vertexBufferLayout;
     pipelineDesc.fragment = &fragment;                                  // wgpu::FragmentState
@@ -402,6 +422,43 @@ void initRenderPipeline()
 
     // Create Render Pipeline
     pipeline = device.CreateRenderPipeline(&pipelineDesc);
+
+    // Bind the uniform buffer (a slot: offset at SetBindGroup)
+    wgpu::BindGroupEntry bindingEntry;
+    bindingEntry.binding = 0;
+    bindingEntry.buffer  = ubo;
+    bindingEntry.offset  = 0;
+    bindingEntry.size    = sizeof( uboData );
+
+    wgpu::BindGroupDescriptor bindGroupDescriptor;
+    bindGroupDescriptor.layout     = bindGroupLayout;
+    bindGroupDescriptor.entryCount = 1;
+    bindGroupDescriptor.entries    = &bindingEntry;
+    bindGroup = device.CreateBindGroup(&bindGroupDescriptor );
+}
+
+// static scene draws, same commands in a RenderBundleEncoder (recorded once) or in the RenderPassEncoder (every frame)
+template<class E> void encodeScene(E &enc, uint32_t slot)
+{
+    const uint32_t offset = slot * uboSlotStride;
+    enc.SetPipeline(pipeline);
+    enc.SetVertexBuffer(0, vertexBuffer, 0, sizeof(cubePNC));
+    enc.SetBindGroup(0, bindGroup, 1, &offset);
+    enc.Draw(12 * 3, 2, 0, 0);
+}
+
+// bundles depend only from formats (not from surface size): built once
+void buildSceneBundles()
+{
+    wgpu::RenderBundleEncoderDescriptor bundleDesc;
+    bundleDesc.colorFormatCount   = 1;
+    bundleDesc.colorFormats       = &preferredFormat;
+    bundleDesc.depthStencilFormat = depthTextureFormat;
+    for(uint32_t i = 0; i < uboSlots; i++) {
+        wgpu::RenderBundleEncoder bundleEncoder = device.CreateRenderBundleEncoder(&bundleDesc);
+        encodeScene(bundleEncoder, i);
+        sceneBundles[i] = bundleEncoder.Finish();
+    }
 }
 
 void resizeSurface(const uint32_t width, const uint32_t height)
@@ -513,7 +570,12 @@ void updateMatrices()
     // light has orbit invariant around cube, of ray always length(lightPos), so...
     // uboFrag.lightPos = getLightPosFromQuat(vgTrackball.refSecondRot(),length(lightPos)) + vgTrackball.getPosition();
 
-    device.GetQueue().WriteBuffer( ubo, 0, &uboMat, sizeof( uboData ) );
+    // only if changed: in next slot (not the one read by previous frame)
+    if(uboTracker.changed(uboMat)) {
+        uboSlot = (uboSlot + 1) % uboSlots;
+        device.GetQueue().WriteBuffer( ubo, uboSlot * uboSlotStride, &uboMat, sizeof( uboData ) );
+        frameStats.writes++; frameStats.writeBytes += sizeof( uboData );
+    }
 }
 
 void renderImGui()
@@ -622,36 +684,22 @@ void mainLoop()
     renderPassDesc.colorAttachments       = &colorAttach;
     renderPassDesc.depthStencilAttachment = &depthAttach;
 
+    const auto encodeStart = std::chrono::steady_clock::now();
     wgpu::CommandEncoderDescriptor enc_desc;
     wgpu::CommandEncoder encoder = device.CreateCommandEncoder(&enc_desc);
 
     wgpu::RenderPassEncoder pass = encoder.BeginRenderPass(&renderPassDesc);
 
-    pass.SetPipeline(pipeline);
-    pass.SetVertexBuffer(0, vertexBuffer, 0, sizeof(cubePNC));
-
-    // Bind the uniform buffer.
-    wgpu::BindGroupEntry bindingEntry;
-    bindingEntry.binding = 0;
-    bindingEntry.buffer  = ubo;
-    bindingEntry.offset  = 0;
-    bindingEntry.size    = sizeof( uboData );
-
-    wgpu::BindGroupDescriptor bindGroupDescriptor;
-    bindGroupDescriptor.layout     = bindGroupLayout;
-    bindGroupDescriptor.entryCount = 1;
-    bindGroupDescriptor.entries    = &bindingEntry;
-    wgpu::BindGroup bindGroup        = device.CreateBindGroup(&bindGroupDescriptor );
-
-    pass.SetBindGroup(0, bindGroup, 0, nullptr );
-
-    pass.Draw(12 * 3, 2, 0, 0);
+    // cube and light: replay pre-recorded bundle of current uniform slot
+    if(useBundles) pass.ExecuteBundles(1, &sceneBundles[uboSlot]);
+    else           encodeScene(pass, uboSlot);
 
     ImGui_ImplWGPU_RenderDrawData(ImGui::GetDrawData(), pass.Get()); // add Imgui RenderPass data
     pass.End();
 
     wgpu::CommandBufferDescriptor cmd_buffer_desc;
     wgpu::CommandBuffer cmd_buffer = encoder.Finish(&cmd_buffer_desc);
+    frameStats.encodeUs += std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - encodeStart).count();
     device.GetQueue().Submit(1, &cmd_buffer);
 
 #if !defined(__EMSCRIPTEN__)
@@ -711,6 +759,8 @@ int main(int, char**)
     setScene();
 
     initRenderPipeline();
+    if(const char *noBundles = getenv("VGIZMO_NO_BUNDLES")) useBundles = atoi(noBundles) == 0;
+    buildSceneBundles();
     initImGui();
 
     resizeSurface(initialWindowWidth, initialWindowHeight);
@@ -726,6 +776,14 @@ int main(int, char**)
 #else
     SDL_Event event;
     bool canCloseWindow = false;
+    // frame pacer: PresentMode::Fifo (vSync) paces the frames ==> only measures and, when nothing moves, waits input events
+    framePacer pacer(0);
+
+    // Frame stats: VGIZMO_FRAME_STATS=frames ==> every "frames" frames print CPU encode time and queue writes for frame
+    // (also headless: Dawn Null or SwiftShader backend)
+    const char *statsEnv = getenv("VGIZMO_FRAME_STATS");
+    const uint64_t statsFrames = statsEnv ? strtoull(statsEnv, nullptr, 10) : 0;
+
     // Main loop
     while (!canCloseWindow) {
         while (SDL_PollEvent(&event)) // Poll and handle events (inputs, window resize, etc.)
@@ -737,6 +795,19 @@ int main(int, char**)
                 canCloseWindow = true;
         }
         mainLoop();
+        pacer.endFrame();
+        if(statsFrames && pacer.getStats().frames >= statsFrames) {
+            const framePacer::stats &st = pacer.getStats();
+            printf("frames %llu (%s):  encode %.1f us  queue writes %.2f (%.0f bytes) for frame  frame %.0f us\n", (unsigned long long) st.frames,
+                   useBundles ? "bundles" : "no bundles", frameStats.encodeUs / st.frames, double(frameStats.writes) / st.frames,
+                   double(frameStats.writeBytes) / st.frames, st.avgFrameUs);
+            pacer.resetStats();
+            frameStats = {};
+        }
+        if(pacer.shouldBlock(vgizmo.isIdleRotating() || ImGui::IsAnyItemActive())) {
+            SDL_WaitEventTimeout(nullptr, int(pacer.getIdleTimeout() * 1000.0));    // event stays in queue
+            pacer.resync();
+        }
     }
 
     // Cleanup
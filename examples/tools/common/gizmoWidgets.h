@@ -0,0 +1,77 @@
+//------------------------------------------------------------------------------
+//  Copyright (c) 2025 Michele Morrone
+//  All rights reserved.
+//
+//  https://michelemorrone.eu - https://brutpitt.com
+//
+//  X: https://x.com/BrutPitt - GitHub: https://github.com/BrutPitt
+//
+//  direct mail: brutpitt(at)gmail.com - me(at)michelemorrone.eu
+//
+//  This software is distributed under the terms of the BSD 2-Clause license
+//------------------------------------------------------------------------------
+#pragma once
+
+#include <random>
+
+#include <imguizmo_quat.h>
+
+// Widgets fixture of headless tools (gizmoGpuRef, gizmoAllocTest)
+//
+//  all draw modes, resized solid/axes, reversed axes (from frame number) in
+//  a window of whole display, values of widgets from frameValues
+//
+//      ImGui::NewFrame();
+//      gizmoWidgets::render(gizmoWidgets::randomValues(rng), frame, "##tool");
+//      ImGui::Render();
+//------------------------------------------------------------------------------
+namespace gizmoWidgets {
+
+enum { count = 13 };
+
+struct frameValues {
+    quat q, q2;
+    vec3 dir;
+    vec4 axisAngle;
+};
+
+inline frameValues randomValues(std::mt19937 &rng)
+{
+    std::uniform_real_distribution<float> u(-1.f, 1.f);
+    frameValues v;
+    v.q  = normalize(quat(u(rng), u(rng), u(rng), u(rng)));
+    v.q2 = normalize(quat(u(rng), u(rng), u(rng), u(rng)));
+    v.dir = vec3(u(rng), u(rng), u(rng));
+    v.axisAngle = vec4(u(rng), u(rng), u(rng), u(rng) * 3.f);
+    return v;
+}
+
+inline void render(frameValues v, int frame, const char *windowName)
+{
+    ImGui::SetNextWindowPos(ImVec2(0, 0), ImGuiCond_Always);
+    ImGui::SetNextWindowSize(ImGui::GetIO().DisplaySize, ImGuiCond_Always);
+    ImGui::Begin(windowName, nullptr, ImGuiWindowFlags_NoTitleBar | ImGuiWindowFlags_NoResize | ImGuiWindowFlags_NoScrollbar);
+
+    vec3 panDolly(0.f);
+    ImGui::gizmo3D("##a", v.q, 200);                                                            ImGui::SameLine();
+    ImGui::gizmo3D("##b", v.q, 160, imguiGizmo::mode3Axes | imguiGizmo::sphereAtOrigin);        ImGui::SameLine();
+    ImGui::gizmo3D("##c", v.q, 160, imguiGizmo::mode3Axes | imguiGizmo::modeFullAxes | imguiGizmo::noSolidAtOrigin); ImGui::SameLine();
+    ImGui::gizmo3D("##d", v.q, v.q2, 200);
+    ImGui::gizmo3D("##e", v.dir, 120);                                                          ImGui::SameLine();
+    ImGui::gizmo3D("##f", v.dir, 120, imguiGizmo::modeDirPlane);                                ImGui::SameLine();
+    ImGui::gizmo3D("##g", v.axisAngle, 120, imguiGizmo::mode3Axes | imguiGizmo::sphereAtOrigin | imguiGizmo::modeFullAxes); ImGui::SameLine();
+    ImGui::gizmo3D("##h", v.q, v.dir, 160, imguiGizmo::modeDual | imguiGizmo::sphereAtOrigin);  ImGui::SameLine();
+    ImGui::gizmo3D("##i", panDolly, v.q, 100);
+    imguiGizmo::resizeAxesOf(vec3(.7f, 2.f, 1.5f)); imguiGizmo::resizeSolidOf(1.4f);
+    ImGui::gizmo3D("##j", v.q, 160, imguiGizmo::mode3Axes | imguiGizmo::sphereAtOrigin);        ImGui::SameLine();
+    ImGui::gizmo3D("##k", v.dir, 160, imguiGizmo::modeDirPlane);                                ImGui::SameLine();
+    imguiGizmo::restoreSolidSize(); imguiGizmo::restoreAxesSize();
+    imguiGizmo::reverseX(frame & 1); imguiGizmo::reverseZ(frame & 2);
+    ImGui::gizmo3D("##l", v.q, v.q2, 200, imguiGizmo::modeDual | imguiGizmo::cubeAtOrigin | imguiGizmo::modeFullAxes); ImGui::SameLine();
+    ImGui::gizmo3D("##m", v.q, v.q2, 120, imguiGizmo::modeDual | imguiGizmo::cubeAtOrigin);
+    imguiGizmo::reverseX(false); imguiGizmo::reverseZ(false);
+
+    ImGui::End();
+}
+
+} // end namespace gizmoWidgets
@@ -0,0 +1,105 @@
+//------------------------------------------------------------------------------
+//  Copyright (c) 2025 Michele Morrone
+//  All rights reserved.
+//
+//  https://michelemorrone.eu - https://brutpitt.com
+//
+//  X: https://x.com/BrutPitt - GitHub: https://github.com/BrutPitt
+//
+//  direct mail: brutpitt(at)gmail.com - me(at)michelemorrone.eu
+//
+//  This software is distributed under the terms of the BSD 2-Clause license
+//------------------------------------------------------------------------------
+//
+//  Headless test of the drift of accumulated trackball rotations (vGizmo3D)
+//
+//  Same source for two builds (see CMakeLists.txt): default (renormalized)
+//  and VGIZMO3D_NO_RENORMALIZATION
+//      idle   ==> N idle() updates after a drag: |norm - 1| of getRotation()
+//                 and ns/update
+//      motion ==> N motion() events of a circular drag: |norm - 1| and
+//                 ns/event
+//  Renormalized build checks the norm error against the bound documented in
+//  vGizmo3D_config.h, the other one only reports it
+//
+//  usage: driftTest [-n updates]
+//------------------------------------------------------------------------------
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+#include <vGizmo3D.h>
+
+#if defined(VGIZMO3D_NO_RENORMALIZATION)
+    static const char *policyName = "VGIZMO3D_NO_RENORMALIZATION";
+#else
+    static const char *policyName = "renormalized";
+#endif
+
+static bool check(bool ok, const char *what)
+{
+    printf("  %s: %s\n", ok ? "ok  " : "FAIL", what);
+    return ok;
+}
+
+// norm error in double: float length() rounds at the same level of the error
+static double normError(const quat &q)
+{
+    return std::fabs(std::sqrt(double(q.w) * q.w + double(q.x) * q.x + double(q.y) * q.y + double(q.z) * q.z) - 1.0);
+}
+
+int main(int argc, char **argv)
+{
+    int updates = 10000000;
+    for(int a = 1; a < argc - 1; a++)
+        if(!strcmp(argv[a], "-n")) updates = atoi(argv[++a]);
+    if(updates <= 0) { fprintf(stderr, "usage: %s [-n updates]\n", argv[0]); return EXIT_FAILURE; }
+
+    using clk = std::chrono::steady_clock;
+    auto nsFor = [](clk::time_point a, clk::time_point b, double n) { return std::chrono::duration<double, std::nano>(b - a).count() / n; };
+    bool ok = true;
+    printf("policy: %s - %d updates\n", policyName, updates);
+
+    vg::vGizmo3D track;
+    track.viewportSize(1280, 800);
+
+    // idle: a short drag leaves the idle spin (release without stop), then only idle()
+    double eIdle, nsIdle, stepIdle;
+    {
+        track.setRotation(quat(1, 0, 0, 0));
+        track.mouse(vg::evLeftButton, vg::evNoModifier, true, 640, 400);
+        for(int i = 1; i <= 8; i++) track.motion(640.f + i * 4.f, 400.f + i * 2.f);
+        track.mouse(vg::evLeftButton, vg::evNoModifier, false, 640 + 32, 400 + 16);
+        stepIdle = 2.0 * std::acos(std::min(1.0, double(std::fabs(track.getIdleRotation().w))));
+        track.setRotation(quat(1, 0, 0, 0));
+        const auto t0 = clk::now();
+        for(int i = 0; i < updates; i++) track.idle();
+        nsIdle = nsFor(t0, clk::now(), updates);
+        eIdle = normError(track.getRotation());
+    }
+
+    // motion: circular drag, every event accumulates a step
+    double eMotion, nsMotion;
+    {
+        track.setRotation(quat(1, 0, 0, 0));
+        track.mouse(vg::evLeftButton, vg::evNoModifier, true, 640 + 200.f, 400);
+        const auto t0 = clk::now();
+        for(int i = 0; i < updates; i++) track.motion(640 + 200.f * std::cos(i * .01f), 400 + 150.f * std::sin(i * .01f));
+        nsMotion = nsFor(t0, clk::now(), updates);
+        eMotion = normError(track.getRotation());
+        track.mouse(vg::evLeftButton, vg::evNoModifier, false, 640, 400);
+    }
+
+    printf("  idle  : step %.3g rad - |norm - 1| %.3g - %.1f ns/update\n", stepIdle, eIdle, nsIdle);
+    printf("  motion: |norm - 1| %.3g - %.1f ns/event\n", eMotion, nsMotion);
+    ok &= check(stepIdle > 0, "idle spin after drag");
+#if !defined(VGIZMO3D_NO_RENORMALIZATION)
+    ok &= check(eIdle < 1e-7 && eMotion < 1e-7, "renormalized: |norm - 1| < 1e-7 (vGizmo3D_config.h)");
+#endif
+
+    printf("%s\n", ok ? "PASSED" : "FAILED");
+    return ok ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,156 @@
+//------------------------------------------------------------------------------
+//  Copyright (c) 2025 Michele Morrone
+//  All rights reserved.
+//
+//  https://michelemorrone.eu - https://brutpitt.com
+//
+//  X: https://x.com/BrutPitt - GitHub: https://github.com/BrutPitt
+//
+//  direct mail: brutpitt(at)gmail.com - me(at)michelemorrone.eu
+//
+//  This software is distributed under the terms of the BSD 2-Clause license
+//------------------------------------------------------------------------------
+//
+//  Headless test of vgMath fast transcendental functions (VGM_FAST_MATH)
+//
+//  Same source for two builds (see CMakeLists.txt): libm policy and VGM_FAST_MATH
+//      accuracy   ==> max error of fastSinCos / fastAcos / fastInvSqrt vs double
+//                     libm over dense samples, checked against the bounds in
+//                     vgMath_config.h (always available, for both builds)
+//      throughput ==> ns for call, fast functions vs float libm
+//      trackball  ==> vGizmo3D::motion() ns for event with the build policy
+//
+//  usage: fastMathTest [-n samples]
+//------------------------------------------------------------------------------
+#include <vector>
+#include <algorithm>
+#include <chrono>
+#include <random>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+#include <vGizmo3D.h>
+
+#if defined(VGM_FAST_MATH)
+    static const char *policyName = "VGM_FAST_MATH";
+#else
+    static const char *policyName = "libm";
+#endif
+
+#if defined(__SSE__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 1)
+    static const double invSqrtBound = 2.7e-7;      // SSE rsqrt + 1 Newton step
+#else
+    static const double invSqrtBound = 4.8e-6;      // bit estimate + 2 Newton steps
+#endif
+
+static bool check(bool ok, const char *what)
+{
+    printf("  %s: %s\n", ok ? "ok  " : "FAIL", what);
+    return ok;
+}
+
+int main(int argc, char **argv)
+{
+    int samples = 4000000;
+    for(int a = 1; a < argc - 1; a++)
+        if(!strcmp(argv[a], "-n")) samples = atoi(argv[++a]);
+    if(samples <= 0) { fprintf(stderr, "usage: %s [-n samples]\n", argv[0]); return EXIT_FAILURE; }
+
+    bool ok = true;
+    printf("policy: %s\n", policyName);
+
+    // accuracy: dense samples in the ranges documented in vgMath_config.h, double reference
+    {
+        double eSin = 0, eCos = 0, eAcos = 0, eInv = 0, eSinPi = 0;
+        for(int i = 0; i < samples; i++) {
+            const float t = (i + .5f) / samples;
+            const float a = -1e4f + 2e4f * t, b = -3.1415927f + 6.2831853f * t;
+            float s, c;
+            fastSinCos(a, s, c);
+            eSin = std::max(eSin, std::fabs(s - std::sin(double(a))));
+            eCos = std::max(eCos, std::fabs(c - std::cos(double(a))));
+            fastSinCos(b, s, c);
+            eSinPi = std::max(eSinPi, std::max(std::fabs(s - std::sin(double(b))), std::fabs(c - std::cos(double(b)))));
+
+            const float x = -1.f + 2.f * t;
+            eAcos = std::max(eAcos, std::fabs(fastAcos(x) - std::acos(double(x))));
+
+            const float v = std::exp2(-40.f + 80.f * t);     // 2^-40 .. 2^40
+            const double r = 1.0 / std::sqrt(double(v));
+            eInv = std::max(eInv, std::fabs(fastInvSqrt(v) - r) / r);
+        }
+        printf("max error over %d samples\n", samples);
+        printf("  sin %.3g - cos %.3g (|a| < 1e4) - sin/cos %.3g (|a| < pi) - acos %.3g - invSqrt %.3g rel\n", eSin, eCos, eSinPi, eAcos, eInv);
+        ok &= check(std::max(std::max(eSin, eCos), eSinPi) <= 9.3e-8, "fastSinCos abs error <= 9.3e-8 (|angle| < 1e4)");
+        ok &= check(eAcos <= 6.3e-7, "fastAcos abs error <= 6.3e-7");
+        ok &= check(eInv <= invSqrtBound, "fastInvSqrt rel error within documented bound");
+
+        float s, c;     // exact values where trackball needs them
+        fastSinCos(0.f, s, c);
+        ok &= check(s == 0.f && c == 1.f && fastAcos(1.f) == 0.f && fastAcos(1.5f) == 0.f && std::fabs(fastAcos(-1.f) - 3.14159265f) < 1e-6f,
+                    "sincos(0), acos(1), acos clamp outside [-1, 1]");
+    }
+
+    using clk = std::chrono::steady_clock;
+    auto nsFor = [](clk::time_point a, clk::time_point b, double n) { return std::chrono::duration<double, std::nano>(b - a).count() / n; };
+    volatile float sink = 0.f;
+
+    // throughput: independent calls on an array (best of 5)
+    {
+        const int n = 1 << 16;
+        std::vector<float> in(n);
+        std::mt19937 rng(1);
+        std::uniform_real_distribution<float> u(-1.f, 1.f);
+        for(float &v : in) v = u(rng);
+        struct result { const char *name; double fast, libm; } res[3] = { { "sincos", 1e30, 1e30 }, { "acos", 1e30, 1e30 }, { "invSqrt", 1e30, 1e30 } };
+        for(int r = 0; r < 5; r++) {
+            float acc = 0.f;
+            auto t0 = clk::now();
+            for(float a : in) { float s, c; fastSinCos(a * 3.f, s, c); acc += s + c; }
+            auto t1 = clk::now();
+            for(float a : in) { acc += std::sin(a * 3.f) + std::cos(a * 3.f); }
+            auto t2 = clk::now();
+            for(float a : in) acc += fastAcos(a);
+            auto t3 = clk::now();
+            for(float a : in) acc += std::acos(a);
+            auto t4 = clk::now();
+            for(float a : in) acc += fastInvSqrt(a + 1.5f);
+            auto t5 = clk::now();
+            for(float a : in) acc += 1.f / std::sqrt(a + 1.5f);
+            auto t6 = clk::now();
+            sink = sink + acc;
+            res[0].fast = std::min(res[0].fast, nsFor(t0, t1, n)); res[0].libm = std::min(res[0].libm, nsFor(t1, t2, n));
+            res[1].fast = std::min(res[1].fast, nsFor(t2, t3, n)); res[1].libm = std::min(res[1].libm, nsFor(t3, t4, n));
+            res[2].fast = std::min(res[2].fast, nsFor(t4, t5, n)); res[2].libm = std::min(res[2].libm, nsFor(t5, t6, n));
+        }
+        printf("%-10s %8s %8s  (ns/call)\n", "", "fast", "libm");
+        for(const result &r : res) printf("%-10s %8.2f %8.2f\n", r.name, r.fast, r.libm);
+    }
+
+    // trackball: vGizmo3D::motion() during a circular drag, with the policy of this build
+    {
+        vg::vGizmo3D track;
+        track.viewportSize(1280, 800);
+        const int events = 200000;
+        std::vector<vec2> path(events);     // precomputed: only motion() is timed
+        for(int i = 0; i < events; i++) path[i] = vec2(640 + 200.f * std::cos(i * .01f), 400 + 150.f * std::sin(i * .01f));
+        double best = 1e30;
+        for(int r = 0; r < 5; r++) {
+            track.setRotation(quat(1, 0, 0, 0));
+            track.mouse(vg::evLeftButton, vg::evNoModifier, true, 640 + 200.f, 400);
+            const auto t0 = clk::now();
+            for(const vec2 &p : path) track.motion(p.x, p.y);
+            best = std::min(best, nsFor(t0, clk::now(), events));
+            track.mouse(vg::evLeftButton, vg::evNoModifier, false, 640, 400);
+            sink = sink + track.getRotation().w;
+        }
+        const quat q = track.getRotation();
+        ok &= check(std::fabs(length(q) - 1.f) < 1e-5f, "trackball rotation stays normalized");
+        printf("vGizmo3D::motion(): %.1f ns/event (%s)\n", best, policyName);
+    }
+
+    printf("%s\n", ok ? "PASSED" : "FAILED");
+    return ok ? EXIT_SUCCESS : EXIT_FAILURE;
+}
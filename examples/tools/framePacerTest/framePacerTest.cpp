@@ -0,0 +1,172 @@
+//------------------------------------------------------------------------------
+//  Copyright (c) 2025 Michele Morrone
+//  All rights reserved.
+//
+//  https://michelemorrone.eu - https://brutpitt.com
+//
+//  X: https://x.com/BrutPitt - GitHub: https://github.com/BrutPitt
+//
+//  direct mail: brutpitt(at)gmail.com - me(at)michelemorrone.eu
+//
+//  This software is distributed under the terms of the BSD 2-Clause license
+//------------------------------------------------------------------------------
+//
+//  Headless timing test of framePacer (no window, no GPU)
+//
+//  Thresholds are relative to the measured OS timer: oversleep of 1 ms sleeps
+//  before the run (p99, rate of "spikes" > slack of frames) and stalls during
+//  the run (late wakes of framePacer, gaps > slack in the busy work)
+//
+//  Simulated frames (busy work of random duration) paced at target fps, after
+//  calibrate() and a warm-up (not in stats):
+//      variable work < target  ==> missed deadlines <= 2 * spike rate + stalls,
+//                                  jitter < maxJitter + p99 oversleep (+ stalls
+//                                  share of max late), average interval ~ target
+//      work > target           ==> all missed, no burst (intervals >= work)
+//      idle                    ==> blocks after N not animating frames
+//  and, as reference, the old fixed sleep (16 ms after the work)
+//
+//  usage: framePacerTest [-f fps] [-n frames] [-j maxJitterUs]
+//------------------------------------------------------------------------------
+#include <random>
+#include <vector>
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <cmath>
+
+#include "utils/framePacer.h"
+
+using clk = std::chrono::steady_clock;
+
+// busy work, return max gap between clock reads (us): thread not running (stall)
+static double busyWork(double us)
+{
+    clk::time_point now = clk::now(), last = now;
+    const clk::time_point end = now + std::chrono::duration_cast<clk::duration>(std::chrono::duration<double, std::micro>(us));
+    clk::duration gap(0);
+    while(now < end) { last = now; now = clk::now(); gap = std::max(gap, now - last); }
+    return std::chrono::duration<double, std::micro>(gap).count();
+}
+
+// oversleep of OS timer: sleeps of 1 ms, sorted (us)
+static std::vector<double> measureOversleep(int samples)
+{
+    std::vector<double> over(samples);
+    for(double &o : over) {
+        const clk::time_point wakeAt = clk::now() + std::chrono::milliseconds(1);
+        std::this_thread::sleep_until(wakeAt);
+        o = std::chrono::duration<double, std::micro>(clk::now() - wakeAt).count();
+    }
+    std::sort(over.begin(), over.end());
+    return over;
+}
+
+static void printStats(const char *name, const framePacer::stats &s)
+{
+    printf("%-12s frames %4llu - missed %4llu - work avg %7.0f us - interval avg %7.0f us - jitter %6.0f us - max late %6.0f us\n", name,
+           (unsigned long long) s.frames, (unsigned long long) s.missed, s.avgWorkUs, s.avgFrameUs, s.jitterUs, s.maxLateUs);
+}
+
+static bool check(bool ok, const char *what)
+{
+    printf("  %s: %s\n", ok ? "ok  " : "FAIL", what);
+    return ok;
+}
+
+int main(int argc, char **argv)
+{
+    double fps = 60, maxJitter = 1000;
+    int frames = 120;
+    for(int a = 1; a < argc - 1; a++) {
+        if     (!strcmp(argv[a], "-f")) fps       = atof(argv[++a]);
+        else if(!strcmp(argv[a], "-n")) frames    = atoi(argv[++a]);
+        else if(!strcmp(argv[a], "-j")) maxJitter = atof(argv[++a]);
+    }
+    if(fps <= 0 || frames <= 0) { fprintf(stderr, "usage: %s [-f fps] [-n frames] [-j maxJitterUs]\n", argv[0]); return EXIT_FAILURE; }
+
+    const double target = 1e6 / fps;
+    std::mt19937 rng(1);
+    std::uniform_real_distribution<double> work(.05 * target, .75 * target);
+    bool ok = true;
+
+    // OS timer: thresholds of checks
+    const std::vector<double> over = measureOversleep(200);
+    const double overP99 = over[over.size() * 99 / 100], overMax = over.back();
+    const double slack = target - work.b();        // min wait of a frame: oversleep > slack ==> missed
+    const double spikeRate = double(over.end() - std::upper_bound(over.begin(), over.end(), slack)) / over.size();
+    printf("timer        oversleep median %5.0f us - p99 %6.0f us - max %6.0f us - over slack (%.0f us) %.1f%%\n",
+           over[over.size() / 2], overP99, overMax, slack, spikeRate * 100);
+
+    // variable work, always < target: margin from calibrate(), warm-up frames not in stats
+    framePacer pacer(fps);
+    const double calibrated = pacer.calibrate();
+    printf("  calibrate: max oversleep %.0f us ==> spin margin %.0f us\n", calibrated, pacer.getSpinMargin());
+    const int warmUp = 10;
+    for(int i = 0; i < warmUp; i++) { busyWork(work(rng)); pacer.endFrame(); }
+    pacer.resetStats();
+    uint64_t workStalls = 0;
+    for(int i = 0; i < frames; i++) { workStalls += busyWork(work(rng)) > slack; pacer.endFrame(); }
+    framePacer::stats s = pacer.getStats();
+    const uint64_t stalls = workStalls + s.lateWakes;
+    const uint64_t missedLimit = uint64_t(std::ceil(2 * spikeRate * frames)) + stalls;
+    const double jitterLimit = maxJitter + overP99 + s.maxLateUs * std::sqrt(double(stalls) / frames);
+    printStats("paced", s);
+    printf("  spin margin %.0f us - stalls %llu (late wakes %llu) - limits: missed %llu, jitter %.0f us\n", pacer.getSpinMargin(),
+           (unsigned long long) stalls, (unsigned long long) s.lateWakes, (unsigned long long) missedLimit, jitterLimit);
+    ok &= check(s.missed <= missedLimit, "missed deadlines <= 2 * rate of timer spikes + stalls");
+    ok &= check(s.jitterUs < jitterLimit, "jitter < max jitter + p99 oversleep (+ stalls)");
+    ok &= check(std::abs(s.avgFrameUs - target) < jitterLimit, "average interval ~ target");
+
+    // work > target: missed, schedule restarts from now (no burst of short frames)
+    pacer.resync();
+    pacer.resetStats();
+    const int slowFrames = frames / 4 > 4 ? frames / 4 : 4;
+    double minInterval = 1e30;
+    clk::time_point last = clk::now();
+    for(int i = 0; i < slowFrames; i++) {
+        busyWork(i < slowFrames / 2 ? 1.5 * target : .1 * target);
+        pacer.endFrame();
+        const clk::time_point now = clk::now();
+        if(i) minInterval = std::min(minInterval, std::chrono::duration<double, std::micro>(now - last).count());
+        last = now;
+    }
+    s = pacer.getStats();
+    printStats("overloaded", s);
+    ok &= check(s.missed >= uint64_t(slowFrames / 2 - 1), "slow frames counted as missed");
+    printf("  min interval %.0f us\n", minInterval);
+    // a late wake shortens the next interval by its delay (absolute deadlines): burst ==> ~ .1 target
+    ok &= check(minInterval > target - (maxJitter + overP99 + s.maxLateUs), "no burst after missed frames (min interval > target - late wake)");
+
+    // idle: block after N not animating frames, some frames after every wait
+    pacer.setIdle(3, .01);
+    int blocks = 0;
+    for(int i = 0; i < 20; i++) {
+        if(pacer.shouldBlock(i < 5)) {      // animating only in first 5 frames
+            blocks++;
+            std::this_thread::sleep_for(std::chrono::duration<double>(pacer.getIdleTimeout()));    // waitEvents(timeout)
+            pacer.resync();
+        }
+        pacer.endFrame();
+    }
+    printf("idle         blocks %d of 12 not animating frames\n", blocks);
+    ok &= check(blocks == 3, "block after 3 not animating frames, 3 frames after every wait");
+
+    // reference: fixed sleep after the work (old waitFor(16000))
+    rng.seed(1);
+    double sumInterval = 0, sumSq = 0;
+    last = clk::now();
+    for(int i = 0; i < frames; i++) {
+        busyWork(work(rng));
+        std::this_thread::sleep_for(std::chrono::microseconds(16000));
+        const clk::time_point now = clk::now();
+        const double d = std::chrono::duration<double, std::micro>(now - last).count();
+        sumInterval += d; sumSq += (d - target) * (d - target);
+        last = now;
+    }
+    printf("fixed sleep  interval avg %7.0f us - jitter %6.0f us (reference)\n", sumInterval / frames, std::sqrt(sumSq / frames));
+
+    printf("%s\n", ok ? "PASSED" : "FAILED");
+    return ok ? EXIT_SUCCESS : EXIT_FAILURE;
+}
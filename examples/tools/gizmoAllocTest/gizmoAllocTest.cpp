@@ -0,0 +1,126 @@
+//------------------------------------------------------------------------------
+//  Copyright (c) 2025 Michele Morrone
+//  All rights reserved.
+//
+//  https://michelemorrone.eu - https://brutpitt.com
+//
+//  X: https://x.com/BrutPitt - GitHub: https://github.com/BrutPitt
+//
+//  direct mail: brutpitt(at)gmail.com - me(at)michelemorrone.eu
+//
+//  This software is distributed under the terms of the BSD 2-Clause license
+//------------------------------------------------------------------------------
+//
+//  Headless check of heap allocations in ImGuIZMO.quat widgets (no window, no GPU)
+//
+//  All ImGui/ImVector memory goes through ImGui::SetAllocatorFunctions ==>
+//  counted. Same widgets of gizmoGpuRef (../common/gizmoWidgets.h: all draw
+//  modes, resized solid/axes, reversed axes) on a cycle of random rotations:
+//      warm-up  ==> cycle repeated (-w): static meshes, derived meshes, frame
+//                   arena, ImDrawList buffers and draw records reach their size
+//      steady   ==> cycle repeated (-c): no allocation and no derived mesh
+//                   rebuild (imguiGizmo::derivedBuilds) expected
+//  both for CPU path (tessellation in ImDrawList) and GPU path (drawRecord +
+//  callback, callback never executed: no renderer)
+//
+//  usage: gizmoAllocTest [-w warmupCycles] [-c cycles] [-s seed]
+//------------------------------------------------------------------------------
+#include <vector>
+#include <random>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+#include <imguizmo_quat.h>
+#include "../common/gizmoWidgets.h"
+
+struct allocCounter {
+    long allocs = 0, frees = 0;
+    size_t bytes = 0;
+};
+
+static void *countedAlloc(size_t size, void *user)
+{
+    allocCounter *c = (allocCounter *) user;
+    c->allocs++; c->bytes += size;
+    return malloc(size);
+}
+
+static void countedFree(void *ptr, void *user)
+{
+    if(ptr) ((allocCounter *) user)->frees++;
+    free(ptr);
+}
+
+static void noDraw(const ImDrawList *, const ImDrawCmd *) {}   // GPU path: records only
+
+static void renderFrame(const gizmoWidgets::frameValues &v, int frame)
+{
+    ImGuiIO &io = ImGui::GetIO();
+    io.DisplaySize = ImVec2(1280, 800);
+    io.DeltaTime = 1.f/60.f;
+
+    ImGui::NewFrame();
+    gizmoWidgets::render(v, frame, "##allocTest");
+    ImGui::Render();
+}
+
+static bool check(bool ok, const char *what)
+{
+    printf("  %s: %s\n", ok ? "ok  " : "FAIL", what);
+    return ok;
+}
+
+int main(int argc, char **argv)
+{
+    int warmup = 2, cycles = 10; unsigned seed = 7;
+    for(int a = 1; a < argc - 1; a++) {
+        if     (!strcmp(argv[a], "-w")) warmup = atoi(argv[++a]);
+        else if(!strcmp(argv[a], "-c")) cycles = atoi(argv[++a]);
+        else if(!strcmp(argv[a], "-s")) seed = unsigned(atoi(argv[++a]));
+    }
+    if(warmup < 1 || cycles < 1) { fprintf(stderr, "usage: %s [-w warmupCycles] [-c cycles] [-s seed]\n", argv[0]); return EXIT_FAILURE; }
+
+    allocCounter counter;
+    ImGui::SetAllocatorFunctions(countedAlloc, countedFree, &counter);     // before context: all ImGui memory
+    ImGui::CreateContext();
+    ImGuiIO &io = ImGui::GetIO();
+    io.IniFilename = nullptr;
+    io.LogFilename = nullptr;
+    unsigned char *pixels; int w, h;
+    io.Fonts->GetTexDataAsRGBA32(&pixels, &w, &h);     // headless: build atlas only
+
+    // cycle of frames: steady state replays rotations already seen in warm-up
+    const int cycleFrames = 120;
+    std::mt19937 rng(seed);
+    std::vector<gizmoWidgets::frameValues> values(cycleFrames);
+    for(gizmoWidgets::frameValues &v : values) v = gizmoWidgets::randomValues(rng);
+
+    bool ok = true;
+    for(int gpuPath = 0; gpuPath < 2; gpuPath++) {
+        imguiGizmo::setDrawCallback(gpuPath ? noDraw : nullptr);
+        const allocCounter start = counter;
+        for(int c = 0; c < warmup; c++)
+            for(int f = 0; f < cycleFrames; f++) renderFrame(values[f], f);
+        const allocCounter warm = counter;
+        const unsigned warmBuilds = imguiGizmo::derivedBuilds;
+        for(int c = 0; c < cycles; c++)
+            for(int f = 0; f < cycleFrames; f++) renderFrame(values[f], f);
+
+        const long steady = counter.allocs - warm.allocs;
+        printf("%s path: warm-up %d frames %ld allocations (%.1f KB) - steady %d frames %ld allocations, %ld frees - frame arena %d bytes\n",
+               gpuPath ? "GPU" : "CPU", warmup * cycleFrames, warm.allocs - start.allocs, (warm.bytes - start.bytes) / 1024.,
+               cycles * cycleFrames, steady, counter.frees - warm.frees, imguiGizmo::arena.buffer.size());
+        ok &= check(!steady, gpuPath ? "GPU path: no allocation in steady state" : "CPU path: no allocation in steady state");
+        if(!gpuPath) {  // derived meshes (CPU path): built in warm-up, never rebuilt with same settings
+            const unsigned rebuilds = imguiGizmo::derivedBuilds - warmBuilds;
+            printf("CPU path: derived meshes built in warm-up %u - steady %u\n", warmBuilds, rebuilds);
+            ok &= check(!rebuilds, "CPU path: no derived mesh rebuild in steady state");
+        }
+    }
+    imguiGizmo::setDrawCallback(nullptr);
+    ImGui::DestroyContext();
+
+    printf("%s\n", ok ? "PASSED" : "FAILED");
+    return ok ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,195 @@
+//------------------------------------------------------------------------------
+//  Copyright (c) 2025 Michele Morrone
+//  All rights reserved.
+//
+//  https://michelemorrone.eu - https://brutpitt.com
+//
+//  X: https://x.com/BrutPitt - GitHub: https://github.com/BrutPitt
+//
+//  direct mail: brutpitt(at)gmail.com - me(at)michelemorrone.eu
+//
+//  This software is distributed under the terms of the BSD 2-Clause license
+//------------------------------------------------------------------------------
+//
+//  Headless test / benchmark of the vGizmo3D event path
+//
+//  Same recorded event stream (rotate, secondary rotate, axis rotate, pan,
+//  dolly, immediate mode) replayed on:
+//      vGizmo3D                          ==> runtime flips
+//      vGizmo3D via virtualGizmoBaseClass ==> virtual dispatch
+//      vGizmo3DStatic<FLAGS>             ==> flips folded at compile time
+//      vGizmo3DStatic<... | RotOnly>     ==> rotations only
+//  checks identical results (static vs runtime flips set to same values)
+//  and reports M events/s
+//
+//  Second build (_trace, VGIZMO_TRACE_EVENTS): checks that the zones of the
+//  event path (vGizmo3D::motion / updateGizmo) fire also for vGizmo3DStatic
+//
+//  usage: gizmoEventBench [-n events]
+//------------------------------------------------------------------------------
+#include <vector>
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <type_traits>
+#include <utility>
+
+#include <vGizmo3D.h>
+
+static bool check(bool ok, const char *what)
+{
+    printf("  %s: %s\n", ok ? "ok  " : "FAIL", what);
+    return ok;
+}
+
+// recorded events: press / release / motion / immediate mode
+struct event { enum { press, release, motion, immediate } type; vgButtons button; vgModifiers mod; float x, y, dx, dy; };
+
+static std::vector<event> buildEvents(int count)
+{
+    struct drag { vgButtons button; vgModifiers mod; } drags[] = {
+        { vg::evLeftButton , vg::evNoModifier      },   // rotation
+        { vg::evRightButton, vg::evNoModifier      },   // secondary rotation
+        { vg::evLeftButton , vg::evShiftModifier   },   // rotation on X axis
+        { vg::evRightButton, vg::evControlModifier },   // pan
+        { vg::evRightButton, vg::evShiftModifier   },   // dolly
+    };
+    std::vector<event> ev;
+    ev.reserve(count + 64);
+    for(int d = 0; int(ev.size()) < count; d++) {
+        const drag &g = drags[d % 5];
+        const float cx = 640 + 100.f * std::cos(d * .7f), cy = 400 + 80.f * std::sin(d * .9f);
+        if(d % 7 == 6) {    // immediate mode burst (imGuIZMO style)
+            for(int i = 0; i < 200; i++) ev.push_back({ event::immediate, g.button, g.mod, cx + i, cy, 1.5f, -.5f });
+            continue;
+        }
+        ev.push_back({ event::press, g.button, g.mod, cx, cy, 0, 0 });
+        for(int i = 1; i <= 500; i++) ev.push_back({ event::motion, g.button, g.mod, cx + 150.f * std::sin(i * .013f), cy + 90.f * std::sin(i * .021f), 0, 0 });
+        ev.push_back({ event::release, g.button, g.mod, cx, cy, 0, 0 });
+    }
+    return ev;
+}
+
+template<class G> static void replay(G &g, const std::vector<event> &ev)
+{
+    for(const event &e : ev) {
+        switch(e.type) {
+            case event::press     : g.mouse(e.button, e.mod, true , e.x, e.y); break;
+            case event::release   : g.mouse(e.button, e.mod, false, e.x, e.y); break;
+            case event::motion    : g.motion(e.x, e.y); break;
+            case event::immediate : g.motionImmediateMode(e.x, e.y, e.dx, e.dy, e.mod); break;
+        }
+    }
+}
+// same through the base class: virtual mouse / motion / update
+typedef vg::vGizmo3D::virtualGizmoBaseClass gizmoBase;     // injected name: template or not
+static void replayBase(gizmoBase &g, const std::vector<event> &ev) { replay(g, ev); }
+
+static bool sameState(vg::vGizmo3D &a, vg::vGizmo3D &b)
+{
+    const quat qa = a.getRotation(), qb = b.getRotation(), sa = a.getSecondRot(), sb = b.getSecondRot();
+    const vec3 pa = a.getPosition(), pb = b.getPosition();
+    return qa.w == qb.w && qa.x == qb.x && qa.y == qb.y && qa.z == qb.z &&
+           sa.w == sb.w && sa.x == sb.x && sa.y == sb.y && sa.z == sb.z && pa.x == pb.x && pa.y == pb.y && pa.z == pb.z;
+}
+
+// vGizmo3DStatic: runtime flip setters are deleted (compile error, not a silent no-op)
+template<class G, class = void> struct hasFlipSetters : std::false_type {};
+template<class G> struct hasFlipSetters<G, decltype(std::declval<G &>().setFlipPanX(true), std::declval<G &>().flipRotOnX(true))> : std::true_type {};
+static_assert( hasFlipSetters<vg::vGizmo3D>::value, "vGizmo3D: runtime flips");
+static_assert(!hasFlipSetters<vg::vGizmo3DStatic<>>::value, "vGizmo3DStatic: flips only from FLAGS");
+
+#if defined(VGIZMO_TRACE_EVENTS)
+static int zoneMotion = 0, zoneUpdate = 0;
+static void countZones(const char *name, uint64_t, uint64_t, void *) {
+    if(!strcmp(name, "vGizmo3D::motion")) zoneMotion++;
+    else if(!strcmp(name, "vGizmo3D::updateGizmo")) zoneUpdate++;
+}
+#endif
+
+int main(int argc, char **argv)
+{
+    int events = 2000000;
+    for(int a = 1; a < argc - 1; a++)
+        if(!strcmp(argv[a], "-n")) events = atoi(argv[++a]);
+    if(events <= 0) { fprintf(stderr, "usage: %s [-n events]\n", argv[0]); return EXIT_FAILURE; }
+
+    const std::vector<event> ev = buildEvents(events);
+    bool ok = true;
+    enum { customFlags = vg::vgStaticFlipRotY | vg::vgStaticFlipRotZ | vg::vgStaticFlipPanX | vg::vgStaticFlipDolly };
+
+    // identical results: static flags == same runtime settings
+    {
+        vg::vGizmo3D dyn, dynCustom;
+        vg::vGizmo3DStatic<> st;
+        vg::vGizmo3DStatic<customFlags> stCustom;
+        dynCustom.flipRotOnX(false); dynCustom.flipRotOnY(true); dynCustom.flipRotOnZ(true);
+        dynCustom.setFlipPanX(true); dynCustom.setFlipPanY(false); dynCustom.setFlipDolly(true);
+        for(vg::vGizmo3D *g : { &dyn, &dynCustom, (vg::vGizmo3D *) &st, (vg::vGizmo3D *) &stCustom }) g->viewportSize(1280, 800);
+        const std::vector<event> few(ev.begin(), ev.begin() + std::min<size_t>(ev.size(), 50000));
+        replay(dyn, few); replay(st, few); replay(dynCustom, few); replay(stCustom, few);
+        ok &= check(sameState(dyn, st), "vGizmo3DStatic<> == vGizmo3D (flags from vGizmo3D_config.h)");
+        ok &= check(sameState(dynCustom, stCustom), "vGizmo3DStatic<custom flags> == vGizmo3D with same runtime flips");
+        ok &= check(stCustom.getFlipRotOnY() && stCustom.getFlipPanX() && !stCustom.getFlipPanY(), "vGizmo3DStatic getFlipXxx() report FLAGS");
+
+        vg::vGizmo3DStatic<vg::vgStaticRotOnly> rotOnly;
+        rotOnly.viewportSize(1280, 800);
+        replay(rotOnly, few);
+        const vec3 p = rotOnly.getPosition();
+        ok &= check(p.x == 0 && p.y == 0 && p.z == 0 && !rotOnly.isPanActive() && !rotOnly.isDollyActive(), "vgStaticRotOnly: pan / dolly never active");
+
+        vg::vGizmo3DStatic<> viaBase;   // through base class: virtual update() ==> static flips
+        viaBase.viewportSize(1280, 800);
+        vg::vGizmo3D dynBase;
+        dynBase.viewportSize(1280, 800);
+        replayBase(viaBase, few); replayBase(dynBase, few);
+        ok &= check(sameState(dynBase, viaBase), "vGizmo3DStatic<> through virtualGizmoBaseClass == vGizmo3D");
+    }
+
+#if defined(VGIZMO_TRACE_EVENTS)
+    // zones of event path also from vGizmo3DStatic
+    {
+        vgTrace::setSink(countZones);
+        vg::vGizmo3DStatic<> st;
+        st.viewportSize(1280, 800);
+        const std::vector<event> few(ev.begin(), ev.begin() + 2000);
+        int motions = 0;
+        for(const event &e : few) motions += e.type == event::motion;
+        replay(st, few);
+        printf("  vGizmo3DStatic: %d motion events ==> %d vGizmo3D::motion, %d vGizmo3D::updateGizmo zones\n", motions, zoneMotion, zoneUpdate);
+        ok &= check(zoneMotion == motions && zoneUpdate > 0, "trace zones fire for vGizmo3DStatic");
+        vgTrace::setSink(nullptr);
+    }
+#endif
+
+    // throughput: M events/s (best of 5)
+    {
+        using clk = std::chrono::steady_clock;
+        auto best = [&](auto &&func) {
+            double t = 1e30;
+            for(int r = 0; r < 5; r++) {
+                const auto t0 = clk::now(); func(); const auto t1 = clk::now();
+                t = std::min(t, std::chrono::duration<double>(t1 - t0).count());
+            }
+            return ev.size() / t * 1e-6;
+        };
+        vg::vGizmo3D dyn, dynBase;
+        vg::vGizmo3DStatic<> st;
+        vg::vGizmo3DStatic<vg::vgStaticFlipRotX | vg::vgStaticRotOnly> rotOnly;
+        for(vg::vGizmo3D *g : { &dyn, &dynBase, (vg::vGizmo3D *) &st, (vg::vGizmo3D *) &rotOnly }) g->viewportSize(1280, 800);
+        struct result { const char *name; double mps; } res[] = {
+            { "vGizmo3D"                , best([&] { replay(dyn, ev); }) },
+            { "vGizmo3D via base class" , best([&] { replayBase(dynBase, ev); }) },
+            { "vGizmo3DStatic<>"        , best([&] { replay(st, ev); }) },
+            { "vGizmo3DStatic<RotOnly>" , best([&] { replay(rotOnly, ev); }) },
+        };
+        printf("%zu events\n", ev.size());
+        for(const result &r : res) printf("%-26s %6.2f M events/s\n", r.name, r.mps);
+    }
+
+    printf("%s\n", ok ? "PASSED" : "FAILED");
+    return ok ? EXIT_SUCCESS : EXIT_FAILURE;
+}
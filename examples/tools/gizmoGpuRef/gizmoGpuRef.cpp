@@ -0,0 +1,126 @@
+//------------------------------------------------------------------------------
+//  Copyright (c) 2025 Michele Morrone
+//  All rights reserved.
+//
+//  https://michelemorrone.eu - https://brutpitt.com
+//
+//  X: https://x.com/BrutPitt - GitHub: https://github.com/BrutPitt
+//
+//  direct mail: brutpitt(at)gmail.com - me(at)michelemorrone.eu
+//
+//  This software is distributed under the terms of the BSD 2-Clause license
+//------------------------------------------------------------------------------
+//
+//  Headless check of ImGuIZMO.quat GPU path (no window, no GPU)
+//
+//  Renders the same widgets (../common/gizmoWidgets.h: all draw modes, resized,
+//  reversed axes) with random rotations two times per frame:
+//      CPU path: tessellated/lighted triangles in ImDrawList
+//      GPU path: drawRecord + callback (imguiGizmo::setDrawCallback)
+//  both rasterized by imguizmoGpuCPU::rasterizer (reference vertex/fragment stages)
+//  and compared pixel by pixel
+//
+//  Output: ImDrawList bytes (vertices + indices + commands [+ records]) and
+//  frame times of both paths, pixel differences (CPU lighting is per vertex,
+//  GPU per fragment ==> small color differences are expected)
+//
+//  usage: gizmoGpuRef [-n frames] [-s seed] [-t maxPercent]
+//      -t maxPercent   ==> exit code EXIT_FAILURE if the pixels with a channel
+//                          difference > 32/255 are more than maxPercent (default 1.0)
+//------------------------------------------------------------------------------
+#include <vector>
+#include <random>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+#include <imguizmo_quat.h>
+#include "utils/imguizmoGpuCPU.h"
+#include "../common/gizmoWidgets.h"
+
+static const int imageWidth = 1280, imageHeight = 800;
+
+struct passStats {
+    double bytes = 0, frameUs = 0, rasterUs = 0;
+};
+
+static size_t drawDataBytes(const ImDrawData *dd)
+{
+    size_t bytes = 0;
+    for(int n = 0; n < dd->CmdListsCount; n++) {
+        const ImDrawList *l = dd->CmdLists[n];
+        bytes += l->VtxBuffer.Size * sizeof(ImDrawVert) + l->IdxBuffer.Size * sizeof(ImDrawIdx) + l->CmdBuffer.Size * sizeof(ImDrawCmd);
+    }
+    return bytes;
+}
+
+static void renderPass(const gizmoWidgets::frameValues &v, int frame, bool gpuPath, imguizmoGpuCPU::rasterizer &r, passStats &st)
+{
+    ImGuiIO &io = ImGui::GetIO();
+    io.DisplaySize = ImVec2(imageWidth, imageHeight);
+    io.DeltaTime = 1.f/60.f;
+    imguiGizmo::setDrawCallback(gpuPath ? imguizmoGpuCPU::drawCallback : nullptr);
+
+    const auto start = std::chrono::steady_clock::now();
+    ImGui::NewFrame();
+    gizmoWidgets::render(v, frame, "##gpuRef");
+    ImGui::Render();
+    const auto built = std::chrono::steady_clock::now();
+
+    const ImDrawData *dd = ImGui::GetDrawData();
+    st.bytes += drawDataBytes(dd) + (gpuPath ? imguiGizmo::drawRecords.size() * sizeof(imguiGizmo::drawRecord) : 0);
+    r.clear(.1f, .1f, .1f);
+    r.render(dd);
+    st.frameUs  += std::chrono::duration<double, std::micro>(built - start).count();
+    st.rasterUs += std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - built).count();
+}
+
+int main(int argc, char **argv)
+{
+    int frames = 100; unsigned seed = 7; float maxPercent = 1.f;
+    for(int a = 1; a < argc - 1; a++) {
+        if     (!strcmp(argv[a], "-n")) frames = std::max(1, atoi(argv[++a]));
+        else if(!strcmp(argv[a], "-s")) seed = unsigned(atoi(argv[++a]));
+        else if(!strcmp(argv[a], "-t")) maxPercent = float(atof(argv[++a]));
+    }
+
+    ImGui::CreateContext();
+    ImGuiIO &io = ImGui::GetIO();
+    io.IniFilename = nullptr;
+    io.LogFilename = nullptr;
+    unsigned char *pixels; int w, h;
+    io.Fonts->GetTexDataAsRGBA32(&pixels, &w, &h);     // headless: build atlas only
+
+    std::mt19937 rng(seed);
+
+    imguizmoGpuCPU::rasterizer cpuImage(imageWidth, imageHeight), gpuImage(imageWidth, imageHeight);
+    passStats cpu, gpu;
+    double sumDiff = 0; float maxDiff = 0; long diffPixels = 0, totalPixels = 0;
+    for(int f = 0; f < frames; f++) {
+        const gizmoWidgets::frameValues v = gizmoWidgets::randomValues(rng);
+
+        renderPass(v, f, false, cpuImage, cpu);
+        renderPass(v, f, true , gpuImage, gpu);
+
+        const float *a = cpuImage.pixels(), *b = gpuImage.pixels();
+        for(int p = 0; p < imageWidth * imageHeight; p++, a += 4, b += 4) {
+            float d = 0;
+            for(int k = 0; k < 3; k++) d = std::max(d, std::fabs(a[k] - b[k]));
+            sumDiff += d; maxDiff = std::max(maxDiff, d);
+            if(d > 32.f/255.f) diffPixels++;
+        }
+        totalPixels += imageWidth * imageHeight;
+    }
+    ImGui::DestroyContext();
+
+    const float percent = 100.f * diffPixels / totalPixels;
+    printf("frames: %d - widgets: %d - image %dx%d\n", frames, int(gizmoWidgets::count), imageWidth, imageHeight);
+    printf("ImDrawList bytes/frame: CPU %.0f - GPU %.0f (records included)\n", cpu.bytes / frames, gpu.bytes / frames);
+    printf("NewFrame..Render us/frame: CPU %.1f - GPU %.1f\n", cpu.frameUs / frames, gpu.frameUs / frames);
+    printf("rasterizer us/frame: CPU %.1f - GPU %.1f (GPU total: instances %d, triangles %d)\n", cpu.rasterUs / frames, gpu.rasterUs / frames,
+                                                                                   gpuImage.instancesCount, gpuImage.trianglesCount);
+    printf("pixel diff: mean %.5f - max %.3f - pixels > 32/255: %.3f%%\n", sumDiff / totalPixels, maxDiff, percent);
+
+    return percent <= maxPercent ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,168 @@
+//------------------------------------------------------------------------------
+//  Copyright (c) 2025 Michele Morrone
+//  All rights reserved.
+//
+//  https://michelemorrone.eu - https://brutpitt.com
+//
+//  X: https://x.com/BrutPitt - GitHub: https://github.com/BrutPitt
+//
+//  direct mail: brutpitt(at)gmail.com - me(at)michelemorrone.eu
+//
+//  This software is distributed under the terms of the BSD 2-Clause license
+//------------------------------------------------------------------------------
+//
+//  Headless benchmark of ImGuIZMO.quat CPU tessellation, one line for each
+//  draw mode (all imguiGizmo::tessDispatch instantiations)
+//
+//  Same random rotations for every mode, two measures:
+//      tess   ==> only tessellation core: tessDispatch(mode)(params) ==> solidPrims
+//      widget ==> whole ImGui::gizmo3D call (input, tessellation, depth sort,
+//                 emission in ImDrawList), inside NewFrame..Render
+//
+//  Output: us for widget, visible primitives and ImDrawList vertices for widget
+//
+//  usage: gizmoModeBench [-n widgets] [-s seed] [-p trace.json]
+//      -p trace.json ==> zones of all widgets as Chrome trace-event JSON (Perfetto)
+//                        only if built with VGIZMO_TRACE_EVENTS (see CMakeLists.txt)
+//------------------------------------------------------------------------------
+#include <vector>
+#include <random>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+#include <imguizmo_quat.h>
+
+struct benchMode {
+    const char *name;
+    uint32_t flags;         // gizmo3D mode
+    int widget;             // gizmo3D overload: 0 quat, 1 dir vec3, 2 quat + light vec3
+};
+
+static const benchMode benchModes[] = {
+    { "3 axes"                 , imguiGizmo::mode3Axes | imguiGizmo::noSolidAtOrigin                                , 0 },
+    { "3 axes full"            , imguiGizmo::mode3Axes | imguiGizmo::noSolidAtOrigin | imguiGizmo::modeFullAxes     , 0 },
+    { "3 axes + sphere"        , imguiGizmo::mode3Axes | imguiGizmo::sphereAtOrigin                                 , 0 },
+    { "3 axes full + sphere"   , imguiGizmo::mode3Axes | imguiGizmo::sphereAtOrigin  | imguiGizmo::modeFullAxes     , 0 },
+    { "3 axes + cube"          , imguiGizmo::mode3Axes | imguiGizmo::cubeAtOrigin                                   , 0 },
+    { "3 axes full + cube"     , imguiGizmo::mode3Axes | imguiGizmo::cubeAtOrigin    | imguiGizmo::modeFullAxes     , 0 },
+    { "dual"                   , imguiGizmo::modeDual  | imguiGizmo::noSolidAtOrigin                                , 2 },
+    { "dual full"              , imguiGizmo::modeDual  | imguiGizmo::noSolidAtOrigin | imguiGizmo::modeFullAxes     , 2 },
+    { "dual + sphere"          , imguiGizmo::modeDual  | imguiGizmo::sphereAtOrigin                                 , 2 },
+    { "dual full + sphere"     , imguiGizmo::modeDual  | imguiGizmo::sphereAtOrigin  | imguiGizmo::modeFullAxes     , 2 },
+    { "dual + cube"            , imguiGizmo::modeDual  | imguiGizmo::cubeAtOrigin                                   , 2 },
+    { "dual full + cube"       , imguiGizmo::modeDual  | imguiGizmo::cubeAtOrigin    | imguiGizmo::modeFullAxes     , 2 },
+    { "direction"              , imguiGizmo::modeDirection                                                          , 1 },
+    { "direction + plane"      , imguiGizmo::modeDirPlane                                                           , 1 },
+};
+
+int main(int argc, char **argv)
+{
+    int widgets = 2000; unsigned seed = 7;
+    const char *traceFile = nullptr;
+    for(int a = 1; a < argc - 1; a++) {
+        if     (!strcmp(argv[a], "-n")) widgets = atoi(argv[++a]);
+        else if(!strcmp(argv[a], "-s")) seed = unsigned(atoi(argv[++a]));
+        else if(!strcmp(argv[a], "-p")) traceFile = argv[++a];
+    }
+    if(widgets <= 0) { fprintf(stderr, "usage: %s [-n widgets] [-s seed] [-p trace.json]\n", argv[0]); return EXIT_FAILURE; }
+
+    ImGui::CreateContext();
+    ImGuiIO &io = ImGui::GetIO();
+    io.IniFilename = nullptr;
+    io.LogFilename = nullptr;
+    unsigned char *pixels; int w, h;
+    io.Fonts->GetTexDataAsRGBA32(&pixels, &w, &h);     // headless: build atlas only
+    imguiGizmo::setDrawCallback(nullptr);              // CPU path
+    imguiGizmo::buildSolids();
+
+    std::mt19937 rng(seed);
+    std::uniform_real_distribution<float> u(-1.f, 1.f);
+    std::vector<quat> rots(widgets), lights(widgets);
+    std::vector<vec3> dirs(widgets);
+    for(int i = 0; i < widgets; i++) {
+        rots[i]   = normalize(quat(u(rng), u(rng), u(rng), u(rng)));
+        lights[i] = normalize(quat(u(rng), u(rng), u(rng), u(rng)));
+        dirs[i]   = vec3(u(rng), u(rng), u(rng));
+    }
+
+    const float size = 200.f;
+    const int perFrame = 16;                            // widgets in one ImGui frame
+    using clk = std::chrono::steady_clock;
+    auto us = [](clk::time_point a, clk::time_point b) { return std::chrono::duration<double, std::micro>(b - a).count(); };
+
+    printf("widgets: %d for mode (%.0f px), best of 5\n", widgets, size);
+    printf("%-22s %10s %10s %8s %8s\n", "mode", "tess us", "widget us", "prims", "vtx");
+    for(const benchMode &m : benchModes) {
+        VGIZMO_ZONE(m.name);
+        const uint32_t drawMode = m.flags & imguiGizmo::modeMask, origin = m.flags & imguiGizmo::axesModeMask;
+        const bool fullAxes = (m.flags & imguiGizmo::modeFullAxes) != 0;
+        const bool dual = (drawMode & imguiGizmo::modeDual) != 0;
+
+        // tessellation core only: same params that drawFunc builds
+        imguiGizmo::tessParams tp;
+        tp.pos = ImVec2(0, 0); tp.halfSize = size * .5f;
+        tp.resizeAxes = dual && imguiGizmo::axesResizeFactor.x > .75f ? vec3(.75f, imguiGizmo::axesResizeFactor.y, imguiGizmo::axesResizeFactor.z) :
+                                                                       imguiGizmo::axesResizeFactor;
+        tp.startingPoint = (origin & imguiGizmo::sphereAtOrigin) ? imguiGizmo::sphereRadius * imguiGizmo::solidResizeFactor :
+                          ((origin & imguiGizmo::cubeAtOrigin  ) ? imguiGizmo::cubeSize     * imguiGizmo::solidResizeFactor :
+                                                                   imguiGizmo::cylRadius * .5f);
+        const imguiGizmo::tessFunc tess = imguiGizmo::tessDispatch(drawMode, origin, fullAxes);
+        double tTess = 1e30; long prims = 0;
+        for(int r = 0; r < 5; r++) {
+            prims = 0;
+            const auto t0 = clk::now();
+            for(int i = 0; i < widgets; i++) {
+                tp.q = rots[i]; tp.qDual = lights[i];
+                tess(tp);
+                prims += imguiGizmo::scratch.nPrims;
+            }
+            tTess = std::min(tTess, us(t0, clk::now()));
+        }
+
+        // whole widget
+        double tWidget = 1e30; long vtx = 0;
+        for(int r = 0; r < 5; r++) {
+            vtx = 0;
+            double t = 0;
+            for(int i = 0; i < widgets; i += perFrame) {
+                io.DisplaySize = ImVec2(size * 4, size * 4);
+                io.DeltaTime = 1.f/60.f;
+                const auto t0 = clk::now();
+                VGIZMO_ZONE_BEGIN(zoneFrame, "gizmoModeBench::frame");
+                ImGui::NewFrame();
+                ImGui::SetNextWindowPos(ImVec2(0, 0), ImGuiCond_Always);
+                ImGui::SetNextWindowSize(io.DisplaySize, ImGuiCond_Always);
+                ImGui::Begin("##modeBench", nullptr, ImGuiWindowFlags_NoTitleBar | ImGuiWindowFlags_NoResize | ImGuiWindowFlags_NoScrollbar);
+                for(int k = i; k < std::min(widgets, i + perFrame); k++) {
+                    ImGui::PushID(k);
+                    quat q = rots[k]; vec3 d = dirs[k];
+                    if     (m.widget == 0) ImGui::gizmo3D("##w", q, size, m.flags);
+                    else if(m.widget == 1) ImGui::gizmo3D("##w", d, size, m.flags);
+                    else                   ImGui::gizmo3D("##w", q, d, size, m.flags);
+                    ImGui::PopID();
+                }
+                ImGui::End();
+                ImGui::Render();
+                VGIZMO_ZONE_END(zoneFrame);
+                t += us(t0, clk::now());
+                const ImDrawData *dd = ImGui::GetDrawData();
+                for(int n = 0; n < dd->CmdListsCount; n++) vtx += dd->CmdLists[n]->VtxBuffer.Size;
+            }
+            tWidget = std::min(tWidget, t);
+        }
+        printf("%-22s %10.2f %10.2f %8.0f %8.0f\n", m.name, tTess / widgets, tWidget / widgets, double(prims) / widgets, double(vtx) / widgets);
+    }
+    ImGui::DestroyContext();
+
+    if(traceFile) {
+#if defined(VGIZMO_TRACE_EVENTS)
+        if(!vgTrace::writeChromeJson(traceFile)) { fprintf(stderr, "%s: can't be written\n", traceFile); return EXIT_FAILURE; }
+        printf("trace events: %s\n", traceFile);
+#else
+        fprintf(stderr, "-p %s: build with VGIZMO_TRACE_EVENTS to record trace events\n", traceFile);
+#endif
+    }
+    return EXIT_SUCCESS;
+}
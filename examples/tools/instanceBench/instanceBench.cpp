@@ -0,0 +1,138 @@
+//------------------------------------------------------------------------------
+//  Copyright (c) 2025 Michele Morrone
+//  All rights reserved.
+//
+//  https://michelemorrone.eu - https://brutpitt.com
+//
+//  X: https://x.com/BrutPitt - GitHub: https://github.com/BrutPitt
+//
+//  direct mail: brutpitt(at)gmail.com - me(at)michelemorrone.eu
+//
+//  This software is distributed under the terms of the BSD 2-Clause license
+//------------------------------------------------------------------------------
+//
+//  Headless benchmark of instance-data builder (commons/utils/instanceData.h)
+//
+//  Same swarm (same seed) updated every frame with the rotation/position of a
+//  vGizmo3D in idle spin (inertia), three ways:
+//      vgMath ==> straight AoS quat/vec3 operations (quat*quat, normalize, mat3*vec3)
+//      scalar ==> builder::updateScalar (SoA, fast inverse sqrt)
+//      update ==> builder::update (SSE 4 instances at time, if available)
+//
+//  Output: ns for instance, MB/s written and max difference from scalar version
+//
+//  usage: instanceBench [-n instances] [-f frames]
+//------------------------------------------------------------------------------
+#include <vector>
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <cmath>
+
+#include <vGizmo3D.h>
+#include "utils/instanceData.h"
+
+using namespace instanceData;
+
+// straight vgMath version: AoS objects as in a "classic" scene graph
+struct naiveObj { quat q, step; vec3 pos; float scale; };
+
+int main(int argc, char **argv)
+{
+    uint32_t nInstances = 100000, nFrames = 200;
+    for(int i = 1; i < argc; i++) {
+        if(!strcmp(argv[i], "-n") && i+1 < argc) nInstances = uint32_t(atoi(argv[++i]));
+        else if(!strcmp(argv[i], "-f") && i+1 < argc) nFrames = uint32_t(atoi(argv[++i]));
+        else { printf("usage: %s [-n instances] [-f frames]\n", argv[0]); return EXIT_FAILURE; }
+    }
+
+    builder simd, scalar;
+    simd.init(nInstances); scalar.init(nInstances);
+
+    // same objects for vgMath version: read back from a first (identity) update
+    std::vector<naiveObj> objs(nInstances);
+    {
+        builder b; b.init(nInstances);
+        std::vector<gpuInstance> a(nInstances), s(nInstances);
+        b.updateScalar(quat(1, 0, 0, 0), vec3(0), a.data());    // q * step
+        for(uint32_t i = 0; i < nInstances; i++) {
+            const gpuInstance &g = a[i];
+            objs[i].q = quat(g.rot[3], g.rot[0], g.rot[1], g.rot[2]);
+            objs[i].pos = vec3(g.posScale[0], g.posScale[1], g.posScale[2]);
+            objs[i].scale = g.posScale[3];
+        }
+        b.updateScalar(quat(1, 0, 0, 0), vec3(0), s.data());    // q * step * step ==> step = conj(q1) * q2
+        for(uint32_t i = 0; i < nInstances; i++) {
+            const quat q2(s[i].rot[3], s[i].rot[0], s[i].rot[1], s[i].rot[2]), &q1 = objs[i].q;
+            objs[i].step = normalize(quat(q1.w, -q1.x, -q1.y, -q1.z) * q2);
+        }
+        // align the builders to the same state (one step done)
+        simd.updateScalar(quat(1, 0, 0, 0), vec3(0), s.data()); scalar.updateScalar(quat(1, 0, 0, 0), vec3(0), s.data());
+    }
+
+    // vGizmo3D in idle spin: drag & release ==> inertia
+    vg::vGizmo3D gizmo;
+    gizmo.viewportSize(1280, 800);
+    gizmo.mouse(vg::evLeftButton, 0, true, 600, 400);
+    gizmo.motion(640, 420);
+    gizmo.mouse(vg::evLeftButton, 0, false, 640, 420);
+    gizmo.setPosition({ .5f, -.25f, 1.f });
+
+    std::vector<gpuInstance> dstNaive(nInstances), dstScalar(nInstances), dstSimd(nInstances);
+    using clock = std::chrono::steady_clock;
+    double tNaive = 0, tScalar = 0, tSimd = 0;
+    for(uint32_t f = 0; f < nFrames; f++) {
+        gizmo.idle();
+        const auto r = gizmo.getRotation();       // tQuat/tVec3: float or double (VGM_USES_DOUBLE_PRECISION)
+        const auto t = gizmo.getPosition();
+
+        auto t0 = clock::now();
+        const quat rf(float(r.w), float(r.x), float(r.y), float(r.z));
+        const vec3 tf(float(t.x), float(t.y), float(t.z));
+        const mat3 m = mat3_cast(rf);
+        for(uint32_t i = 0; i < nInstances; i++) {
+            naiveObj &o = objs[i];
+            o.q = normalize(o.q * o.step);
+            const quat q = rf * o.q;
+            const vec3 p = m * o.pos + tf;
+            gpuInstance &d = dstNaive[i];
+            d.rot[0] = float(q.x); d.rot[1] = float(q.y); d.rot[2] = float(q.z); d.rot[3] = float(q.w);
+            d.posScale[0] = float(p.x); d.posScale[1] = float(p.y); d.posScale[2] = float(p.z); d.posScale[3] = o.scale;
+        }
+        auto t1 = clock::now();
+        scalar.updateScalar(r, t, dstScalar.data());
+        auto t2 = clock::now();
+        simd.update(r, t, dstSimd.data());
+        auto t3 = clock::now();
+
+        tNaive  += std::chrono::duration<double>(t1 - t0).count();
+        tScalar += std::chrono::duration<double>(t2 - t1).count();
+        tSimd   += std::chrono::duration<double>(t3 - t2).count();
+    }
+
+    auto maxDiff = [&](const std::vector<gpuInstance> &a) {
+        float d = 0.f;
+        for(uint32_t i = 0; i < nInstances; i++)
+            for(int k = 0; k < 4; k++) {
+                d = std::max(d, fabsf(a[i].rot[k] - dstScalar[i].rot[k]));
+                d = std::max(d, fabsf(a[i].posScale[k] - dstScalar[i].posScale[k]));
+            }
+        return d;
+    };
+
+    const double n = double(nInstances) * nFrames, mb = n * sizeof(gpuInstance) / (1024. * 1024.);
+#if defined(__SSE__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 1)
+    const char *simdName = "update (SSE)";
+#else
+    const char *simdName = "update (no SSE)";
+#endif
+    printf("instances %u, frames %u, %zu bytes for instance\n", nInstances, nFrames, sizeof(gpuInstance));
+    printf("%-16s %8s %10s %10s %12s\n", "", "ns/inst", "ms/frame", "MB/s", "maxDiff");
+    printf("%-16s %8.2f %10.3f %10.0f %12.3g\n", "vgMath AoS", tNaive  * 1e9 / n, tNaive  * 1e3 / nFrames, mb / tNaive,  maxDiff(dstNaive));
+    printf("%-16s %8.2f %10.3f %10.0f %12.3g\n", "updateScalar", tScalar * 1e9 / n, tScalar * 1e3 / nFrames, mb / tScalar, 0.);
+    printf("%-16s %8.2f %10.3f %10.0f %12.3g\n", simdName, tSimd   * 1e9 / n, tSimd   * 1e3 / nFrames, mb / tSimd,   maxDiff(dstSimd));
+
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,162 @@
+//------------------------------------------------------------------------------
+//  Copyright (c) 2025 Michele Morrone
+//  All rights reserved.
+//
+//  https://michelemorrone.eu - https://brutpitt.com
+//
+//  X: https://x.com/BrutPitt - GitHub: https://github.com/BrutPitt
+//
+//  direct mail: brutpitt(at)gmail.com - me(at)michelemorrone.eu
+//
+//  This software is distributed under the terms of the BSD 2-Clause license
+//------------------------------------------------------------------------------
+//
+//  Offline evaluation of vGizmo3D rotation prediction (getPredictedRotation)
+//
+//  Replays the vGizmo3D events of recorded input traces (inputTrace.h) with
+//  their timestamps: after every motion event (during drag) it stores the
+//  current rotation and the predicted ones for some horizons (8..50 ms)
+//  then it compares them with the real rotation at time + horizon (slerp of
+//  recorded rotations, same drag only)
+//
+//  Output: angular error distribution (degrees) for every horizon
+//      none ==> current rotation (no prediction), pred ==> getPredictedRotation
+//
+//  usage: predictionEval trace.vgtr [trace2.vgtr ...] [-c minCutoff] [-b beta] [-d dCutoff]
+//         predictionEval -s [-c minCutoff] [-b beta] [-d dCutoff]   synthetic drags
+//------------------------------------------------------------------------------
+#include <vector>
+#include <algorithm>
+#include <random>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <cmath>
+
+#include <vGizmo3D.h>
+#include "utils/inputTrace.h"
+
+using namespace inputTrace;
+
+static constexpr int nHorizons = 4;
+static constexpr float horizons[nHorizons] = { .008f, .016f, .033f, .050f };
+
+struct sample {
+    double t;
+    int drag;
+    quat q, pred[nHorizons];
+};
+
+// synthetic drags: variable speed curves + hand jitter, 125 Hz mouse
+static void syntheticTrace(std::vector<traceEvent> &events)
+{
+    std::mt19937 rng(1);
+    std::normal_distribution<float> jitter(0.f, .6f);
+    uint32_t us = 0;
+    auto add = [&](uint8_t type, int button, int pressed, float x, float y) {
+        events.push_back({ 0, us, type, uint8_t(button), uint8_t(pressed), 0, x, y, 0, 0 });
+    };
+    add(evViewport, 0, 0, 1280, 800);
+    for(int drag = 0; drag < 40; drag++) {
+        const float cx = 640, cy = 400, r = 100.f + 8.f * drag;
+        const float speed = 1.f + (drag % 5);                   // rad/sec on the curve
+        const float dur = .6f + .05f * (drag % 7);
+        float a = .3f * drag;
+        add(evMouse, vg::evLeftButton, 1, cx + r*cosf(a), cy + r*sinf(a));
+        for(float t = 0; t < dur; t += .008f) {
+            us += 8000;
+            const float s = speed * (1.f + .5f * sinf(6.f * t));  // accelerations
+            a += s * .008f;
+            add(evMotion, 0, 0, cx + r*cosf(a) + jitter(rng), cy + .7f*r*sinf(a) + jitter(rng));
+        }
+        add(evMouse, vg::evLeftButton, 0, cx + r*cosf(a), cy + r*sinf(a));
+        us += 300000;
+    }
+}
+
+static void replay(const std::vector<traceEvent> &events, float minCutoff, float beta, float dCutoff, std::vector<sample> &samples, int &drag)
+{
+    vg::vGizmo3D track;
+    track.setPrediction(true);
+    track.setPredictionFilter(minCutoff, beta, dCutoff);
+    bool dragging = false;
+    for(const traceEvent &ev : events) {
+        track.setEventTime(ev.timeUs * 1e-6);
+        apply(track, ev);
+        if(ev.type == evMouse) {
+            if(ev.pressed && !dragging) { dragging = true; drag++; }
+            else if(!ev.pressed) dragging = false;
+        }
+        if(ev.type == evMotion && dragging) {
+            sample s { ev.timeUs * 1e-6, drag, track.getRotation(), {} };
+            for(int h = 0; h < nHorizons; h++) s.pred[h] = track.getPredictedRotation(horizons[h]);
+            samples.push_back(s);
+        }
+    }
+}
+
+static float angleDeg(const quat &a, const quat &b)
+{
+    const float d = std::min(1.f, std::abs(dot(a, b)));
+    return 2.f * acosf(d) * 57.2957795f;
+}
+
+static void printStats(const char *name, std::vector<float> &e)
+{
+    if(e.empty()) { printf("  %-5s no samples\n", name); return; }
+    std::sort(e.begin(), e.end());
+    double sum = 0; for(float v : e) sum += v;
+    const size_t n = e.size();
+    printf("  %-5s mean %7.3f  p50 %7.3f  p90 %7.3f  p99 %7.3f  max %7.3f\n", name,
+           sum / n, e[n/2], e[n*90/100], e[std::min(n-1, n*99/100)], e[n-1]);
+}
+
+int main(int argc, char **argv)
+{
+    float minCutoff = 1.f, beta = .02f, dCutoff = 1.f;
+    bool synthetic = false;
+    std::vector<const char *> files;
+    for(int a = 1; a < argc; a++) {
+        if     (!strcmp(argv[a], "-s")) synthetic = true;
+        else if(!strcmp(argv[a], "-c") && a+1 < argc) minCutoff = float(atof(argv[++a]));
+        else if(!strcmp(argv[a], "-b") && a+1 < argc) beta      = float(atof(argv[++a]));
+        else if(!strcmp(argv[a], "-d") && a+1 < argc) dCutoff   = float(atof(argv[++a]));
+        else files.push_back(argv[a]);
+    }
+    if(!synthetic && files.empty()) {
+        fprintf(stderr, "usage: %s trace.vgtr [trace2.vgtr ...] [-c minCutoff] [-b beta] [-d dCutoff]\n"
+                        "       %s -s [-c minCutoff] [-b beta] [-d dCutoff]  (synthetic drags)\n", argv[0], argv[0]);
+        return EXIT_FAILURE;
+    }
+
+    std::vector<sample> samples;
+    int drag = 0;
+    std::vector<traceEvent> events;
+    if(synthetic) { syntheticTrace(events); replay(events, minCutoff, beta, dCutoff, samples, drag); }
+    for(const char *f : files) {
+        if(!load(f, events)) { fprintf(stderr, "%s: not a valid trace\n", f); return EXIT_FAILURE; }
+        replay(events, minCutoff, beta, dCutoff, samples, drag);
+    }
+    printf("filter: minCutoff %g  beta %g  dCutoff %g - drags: %d - samples: %zu\n", minCutoff, beta, dCutoff, drag, samples.size());
+
+    // real rotation at t + horizon: slerp between the recorded samples of the same drag
+    for(int h = 0; h < nHorizons; h++) {
+        std::vector<float> errNone, errPred;
+        size_t j = 0;
+        for(size_t i = 0; i < samples.size(); i++) {
+            const double t = samples[i].t + horizons[h];
+            if(j < i) j = i;
+            while(j+1 < samples.size() && samples[j+1].drag == samples[i].drag && samples[j+1].t < t) j++;
+            if(j+1 >= samples.size() || samples[j+1].drag != samples[i].drag) continue;  // drag ended before t
+            const sample &a = samples[j], &b = samples[j+1];
+            const float k = b.t > a.t ? float((t - a.t) / (b.t - a.t)) : 1.f;
+            const quat real = slerp(a.q, b.q, std::max(0.f, std::min(1.f, k)));
+            errNone.push_back(angleDeg(samples[i].q, real));
+            errPred.push_back(angleDeg(samples[i].pred[h], real));
+        }
+        printf("horizon %2.0f ms (degrees)\n", horizons[h] * 1000.f);
+        printStats("none", errNone);
+        printStats("pred", errPred);
+    }
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,125 @@
+//------------------------------------------------------------------------------
+//  Copyright (c) 2025 Michele Morrone
+//  All rights reserved.
+//
+//  https://michelemorrone.eu - https://brutpitt.com
+//
+//  X: https://x.com/BrutPitt - GitHub: https://github.com/BrutPitt
+//
+//  direct mail: brutpitt(at)gmail.com - me(at)michelemorrone.eu
+//
+//  This software is distributed under the terms of the BSD 2-Clause license
+//------------------------------------------------------------------------------
+//
+//  Headless test of progressive::scheduler (no window, no GPU)
+//
+//  Simulated renderer: pass time = full resolution cost * scale^2
+//      next()      ==> interactive pass while active / dirty, then refine
+//                      passes one for frame, then complete (nothing to render),
+//                      quality limit skips passes, restart()
+//      frameTime() ==> interactive scale converges to sqrt(budget / cost),
+//                      clamped to scale limits, only interactive quality passes
+//                      update the estimate, also when read back frames later
+//                      (GPU timer queries: frameTime(ms, pass))
+//
+//  usage: progressiveTest
+//------------------------------------------------------------------------------
+#include <vector>
+#include <deque>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+
+#include "utils/progressiveRender.h"
+
+static bool check(bool ok, const char *what)
+{
+    printf("  %s: %s\n", ok ? "ok  " : "FAIL", what);
+    return ok;
+}
+
+static bool samePass(const progressive::pass &p, float scale, int quality) { return p.scale == scale && p.quality == quality; }
+
+// frames with time read back "lag" frames later (0 ==> frameTime(ms) just after the pass)
+static float converge(float fullCost, float budget, int lag, int frames, int *passes = nullptr)
+{
+    progressive::scheduler sched;
+    sched.setBudget(budget);
+    std::deque<std::pair<float, progressive::pass>> inFlight;
+    progressive::pass p;
+    int n = 0;
+    for(int f = 0; f < frames; f++) {
+        while(int(inFlight.size()) > lag) { sched.frameTime(inFlight.front().first, inFlight.front().second); inFlight.pop_front(); }
+        if(!sched.next(true, false, p)) continue;
+        n++;
+        const float ms = fullCost * p.scale * p.scale;
+        if(lag) inFlight.push_back({ ms, p });
+        else    sched.frameTime(ms);
+    }
+    if(passes) *passes = n;
+    return sched.getScale();
+}
+
+int main()
+{
+    bool ok = true;
+    progressive::pass p;
+
+    // next(): interactive, refine passes, complete
+    {
+        progressive::scheduler sched;
+        bool seq = sched.next(false, false, p) && samePass(p, .5f, 0) && sched.isInteractive();   // nothing rendered yet
+        seq &= sched.next(true, false, p) && samePass(p, .5f, 0);                                   // gizmo active
+        seq &= sched.next(false, true, p) && samePass(p, .5f, 0);                                   // view changed
+        seq &= sched.next(false, false, p) && samePass(p, 1.f, 0) && !sched.isInteractive();        // refine: full resolution
+        seq &= sched.next(false, false, p) && samePass(p, 1.f, 1);                                  // refine: high quality
+        seq &= !sched.next(false, false, p) && sched.isComplete();                                  // complete
+        seq &= !sched.next(false, false, p);
+        ok &= check(seq, "interactive while active / dirty, then refine passes, then complete");
+
+        seq = sched.next(false, true, p) && samePass(p, .5f, 0) && !sched.isComplete();
+        sched.setQualityLimit(0);
+        seq &= sched.next(false, false, p) && samePass(p, 1.f, 0);
+        seq &= !sched.next(false, false, p) && sched.isComplete();
+        ok &= check(seq, "dirty restarts, quality limit skips high quality pass");
+
+        sched.restart();
+        ok &= check(sched.getRefineIndex() == -1 && sched.next(false, false, p) && sched.isInteractive(), "restart(): interactive pass again");
+    }
+
+    // frameTime(): cost model ms = fullCost * scale^2 ==> scale = sqrt(budget / fullCost)
+    {
+        const float expect = std::sqrt(12.f / 100.f);
+        const float now = converge(100.f, 12.f, 0, 60), late1 = converge(100.f, 12.f, 1, 60), late3 = converge(100.f, 12.f, 3, 60);
+        printf("  scale: %.4f (read at once) - %.4f (1 frame later) - %.4f (3 frames later) - expected %.4f\n", now, late1, late3, expect);
+        ok &= check(std::fabs(now - expect) < 1e-3f, "interactive scale converges to sqrt(budget / cost)");
+        ok &= check(std::fabs(late1 - expect) < 1e-3f && std::fabs(late3 - expect) < 1e-3f, "same scale with times read back frames later: frameTime(ms, pass)");
+
+        ok &= check(converge(1000.f, 12.f, 1, 60) == .25f && converge(1.f, 12.f, 1, 60) == 1.f, "scale clamped to limits [.25, 1]");
+
+        progressive::scheduler sched;
+        sched.setScaleLimits(.1f, .8f);
+        sched.next(true, false, p); sched.frameTime(1e4f);
+        const float lo = sched.getScale();
+        sched.next(true, false, p); sched.frameTime(0.f);    // no measure
+        const bool ignored = sched.getScale() == lo;
+        for(int i = 0; i < 60; i++) { sched.next(true, false, p); sched.frameTime(.01f); }
+        ok &= check(lo == .1f && ignored && sched.getScale() == .8f, "setScaleLimits() clamp, frameTime(0) ignored");
+    }
+
+    // only interactive quality passes update the estimate
+    {
+        progressive::scheduler sched;
+        sched.next(true, false, p); sched.frameTime(25.f * p.scale * p.scale);
+        const float cost = sched.getFullCost();
+        sched.next(false, false, p); sched.frameTime(40.f);                  // refine, quality 0: updates
+        const float afterRefine0 = sched.getFullCost();
+        sched.next(false, false, p); sched.frameTime(500.f);                 // refine, quality 1: ignored
+        const progressive::pass hq = { 1.f, 1 };
+        sched.frameTime(500.f, hq);                                         // read back later: ignored too
+        ok &= check(cost == 25.f && afterRefine0 > cost && sched.getFullCost() == afterRefine0, "high quality passes don't change the cost estimate");
+    }
+
+    printf("%s\n", ok ? "PASSED" : "FAILED");
+    return ok ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,248 @@
+//------------------------------------------------------------------------------
+//  Copyright (c) 2025 Michele Morrone
+//  All rights reserved.
+//
+//  https://michelemorrone.eu - https://brutpitt.com
+//
+//  X: https://x.com/BrutPitt - GitHub: https://github.com/BrutPitt
+//
+//  direct mail: brutpitt(at)gmail.com - me(at)michelemorrone.eu
+//
+//  This software is distributed under the terms of the BSD 2-Clause license
+//------------------------------------------------------------------------------
+//
+//  Headless test of vgMath quaternion log / exp / pow and interpolation
+//  (slerp, nlerp, squad, batch overloads)
+//
+//      reference ==> same formulas in double: max error of float vgMath
+//      identities ==> exp(log(q)) = q, pow(q, .5)^2 = q, slerp/squad end points,
+//                     slerp constant angular velocity, shortest path
+//      GLM        ==> if found by CMake (VGM_TEST_WITH_GLM): max difference vs
+//                     glm::log / exp / pow / slerp / squad / intermediate
+//      throughput ==> ns for call (and GLM when available)
+//
+//  usage: quatInterpTest [-n samples] [-s seed]
+//------------------------------------------------------------------------------
+#include <vector>
+#include <algorithm>
+#include <chrono>
+#include <random>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+#include <vgMath.h>
+
+#if defined(VGM_TEST_WITH_GLM)
+    #define GLM_ENABLE_EXPERIMENTAL
+    #include <glm/glm.hpp>
+    #include <glm/gtc/quaternion.hpp>
+    #include <glm/gtx/quaternion.hpp>
+    static glm::quat toGlm(const quat &q) { return glm::quat(q.w, q.x, q.y, q.z); }
+    static quat fromGlm(const glm::quat &q) { return quat(q.w, q.x, q.y, q.z); }
+#endif
+
+// bounds, float vs double (max component error, rad for angles): measured ~2/3 of them
+//      slerp needs sin(theta) from (1 - c) * (1 + c): with 1 - c*c it was 3.3e-5 (velocity 1.5e-3 rad)
+//      vs GLM: both sides carry float error ==> 2x
+static const double BOUND_LOG = 1e-6, BOUND_SLERP = 4e-7, BOUND_SQUAD = 6e-7, BOUND_VEL = 6e-7, BOUND_ENDS = 4e-7;
+
+static bool check(bool ok, const char *what)
+{
+    printf("  %s: %s\n", ok ? "ok  " : "FAIL", what);
+    return ok;
+}
+
+// double reference (textbook formulas): own type, vgMath can be built float only
+struct refQuat {
+    double w, x, y, z;
+    refQuat operator+(const refQuat &q) const { return { w + q.w, x + q.x, y + q.y, z + q.z }; }
+    refQuat operator*(double s) const { return { w * s, x * s, y * s, z * s }; }
+    refQuat operator-() const { return { -w, -x, -y, -z }; }
+    refQuat operator*(const refQuat &q) const {
+        return { w * q.w - x * q.x - y * q.y - z * q.z, w * q.x + x * q.w + y * q.z - z * q.y,
+                 w * q.y + y * q.w + z * q.x - x * q.z, w * q.z + z * q.w + x * q.y - y * q.x }; }
+};
+static refQuat toRef(const quat &q) { return { q.w, q.x, q.y, q.z }; }
+static refQuat normalize(const refQuat &q) { return q * (1.0 / std::sqrt(q.w * q.w + q.x * q.x + q.y * q.y + q.z * q.z)); }
+static double diff(const quat &a, const refQuat &b) {
+    return std::max(std::max(std::fabs(a.w - b.w), std::fabs(a.x - b.x)), std::max(std::fabs(a.y - b.y), std::fabs(a.z - b.z))); }
+static double diffQ(const quat &a, const quat &b) { return diff(a, toRef(b)); }
+// rotation angle between two quats in double (float angleBetween resolves ~1e-3 rad near 0)
+static double quatAngle(const quat &a, const quat &b) {
+    const double d = std::fabs(double(a.w) * b.w + double(a.x) * b.x + double(a.y) * b.y + double(a.z) * b.z) /
+                     std::sqrt((double(a.w) * a.w + double(a.x) * a.x + double(a.y) * a.y + double(a.z) * a.z) *
+                               (double(b.w) * b.w + double(b.x) * b.x + double(b.y) * b.y + double(b.z) * b.z));
+    return 2.0 * std::acos(std::min(1.0, d)); }
+
+static refQuat refSlerp(const refQuat &x, refQuat y, double a) {
+    double c = x.w * y.w + x.x * y.x + x.y * y.y + x.z * y.z;
+    if(c < 0) { y = -y; c = -c; }
+    if(c > 1.0 - 1e-12) return normalize(x * (1 - a) + y * a);
+    const double t = std::acos(c), s = std::sin(t);
+    return x * (std::sin((1 - a) * t) / s) + y * (std::sin(a * t) / s); }
+static refQuat refLog(const refQuat &q) {
+    const double v = std::sqrt(q.x * q.x + q.y * q.y + q.z * q.z), t = std::atan2(v, q.w) / v;
+    return { std::log(std::sqrt(v * v + q.w * q.w)), q.x * t, q.y * t, q.z * t }; }
+static refQuat refExp(const refQuat &q) {
+    const double a = std::sqrt(q.x * q.x + q.y * q.y + q.z * q.z), e = std::exp(q.w), k = e * std::sin(a) / a;
+    return { e * std::cos(a), q.x * k, q.y * k, q.z * k }; }
+static refQuat refMix(const refQuat &x, const refQuat &y, double a) {   // no shortest path (squad)
+    const double c = x.w * y.w + x.x * y.x + x.y * y.y + x.z * y.z;
+    if(c > 1.0 - 1e-12) return x * (1 - a) + y * a;
+    const double t = std::acos(c), s = std::sin(t);
+    return x * (std::sin((1 - a) * t) / s) + y * (std::sin(a * t) / s); }
+static refQuat refIntermediate(const refQuat &p, const refQuat &c, const refQuat &n) {
+    const refQuat i = { c.w, -c.x, -c.y, -c.z };
+    return refExp((refLog(n * i) + refLog(p * i)) * -.25) * c; }
+
+int main(int argc, char **argv)
+{
+    int samples = 500000; uint32_t seed = 1;
+    for(int a = 1; a < argc - 1; a++) {
+        if     (!strcmp(argv[a], "-n")) samples = atoi(argv[++a]);
+        else if(!strcmp(argv[a], "-s")) seed    = uint32_t(atoi(argv[++a]));
+    }
+    if(samples <= 0) { fprintf(stderr, "usage: %s [-n samples] [-s seed]\n", argv[0]); return EXIT_FAILURE; }
+
+    std::mt19937 rng(seed);
+    std::normal_distribution<float> g(0.f, 1.f);
+    std::uniform_real_distribution<float> u(0.f, 1.f);
+    // qa, qb: random pairs (slerp, log, exp)
+    // qd ==> qa ==> qb ==> qc: animation keys for squad, each one a rotation < 90 deg from previous
+    std::vector<quat> qa(samples), qb(samples), qc(samples), qd(samples), ka(samples), kb(samples);
+    std::vector<float> ta(samples);
+    auto randQuat = [&] { return normalize(quat(g(rng), g(rng), g(rng), g(rng))); };
+    auto nextKey  = [&](const quat &q) { return normalize(q * angleAxis(1.5f * u(rng), normalize(vec3(g(rng), g(rng), g(rng))))); };
+    for(int i = 0; i < samples; i++) {
+        qa[i] = randQuat(); qb[i] = randQuat();
+        qd[i] = randQuat(); ka[i] = nextKey(qd[i]); kb[i] = nextKey(ka[i]); qc[i] = nextKey(kb[i]);
+        ta[i] = u(rng);
+    }
+    bool ok = true;
+
+    // float vgMath vs double reference
+    {
+        double eLog = 0, eExp = 0, eSlerp = 0, eInter = 0, eSquad = 0, eNlerp = 0, eRound = 0, ePow = 0, eVel = 0;
+        for(int i = 0; i < samples; i++) {
+            const quat &x = qa[i], &y = qb[i];
+            const float t = ta[i];
+            const refQuat rx = toRef(x), ry = toRef(y);
+            eLog   = std::max(eLog  , diff(log(x), refLog(rx)));
+            const quat l(log(y) * .7f);                              // exp of non unit log
+            eExp   = std::max(eExp  , diff(exp(l), refExp(toRef(l))));
+            eRound = std::max(eRound, diffQ(exp(log(x)), x));
+            const quat h = pow(x, .5f);
+            ePow   = std::max(ePow  , diffQ(h * h, x));
+            eSlerp = std::max(eSlerp, diff(slerp(x, y, t), refSlerp(rx, ry, t)));
+            eNlerp = std::max(eNlerp, double(std::fabs(length(nlerp(x, y, t)) - 1.f)));
+
+            // squad on keys: intermediate and squad measured apart (same float control points)
+            const quat &k1 = ka[i], &k2 = kb[i];
+            const quat s1 = intermediate(qd[i], k1, k2), s2 = intermediate(k1, k2, qc[i]);
+            eInter = std::max(eInter, diff(s1, refIntermediate(toRef(qd[i]), toRef(k1), toRef(k2))));
+            eSquad = std::max(eSquad, diff(squad(k1, k2, s1, s2, t), refMix(refMix(toRef(k1), toRef(k2), t), refMix(toRef(s1), toRef(s2), t), 2 * (1 - t) * t)));
+
+            // constant angular velocity: angle(x, slerp(t)) = t * angle(x, y)
+            eVel = std::max(eVel, std::fabs(quatAngle(x, slerp(x, y, t)) - t * quatAngle(x, y)));
+        }
+        printf("max error vs double reference over %d samples\n", samples);
+        printf("  log %.3g - exp %.3g - slerp %.3g - intermediate %.3g - squad %.3g - |nlerp| - 1 %.3g\n", eLog, eExp, eSlerp, eInter, eSquad, eNlerp);
+        printf("  exp(log(q)) - q %.3g - pow(q, .5)^2 - q %.3g - slerp velocity %.3g rad\n", eRound, ePow, eVel);
+        ok &= check(eLog < BOUND_LOG && eExp < BOUND_LOG, "log / exp");
+        ok &= check(eRound < BOUND_LOG && ePow < BOUND_LOG, "exp(log(q)) = q, pow(q, 1/2)^2 = q");
+        ok &= check(eSlerp < BOUND_SLERP, "slerp (shortest path)");
+        ok &= check(eInter < BOUND_SQUAD && eSquad < BOUND_SQUAD, "intermediate, squad");
+        ok &= check(eNlerp < 1e-6, "nlerp unit length");
+        ok &= check(eVel < BOUND_VEL, "slerp constant angular velocity");
+
+        double eEnds = 0, eSpin = 0;
+        for(int i = 0; i < std::min(samples, 100000); i++) {
+            const quat s1 = intermediate(qd[i], ka[i], kb[i]), s2 = intermediate(ka[i], kb[i], qc[i]);
+            eEnds = std::max(eEnds, std::max(std::max(quatAngle(slerp(qa[i], qb[i], 0.f), qa[i]), quatAngle(slerp(qa[i], qb[i], 1.f), qb[i])),
+                                             std::max(quatAngle(squad(ka[i], kb[i], s1, s2, 0.f), ka[i]), quatAngle(squad(ka[i], kb[i], s1, s2, 1.f), kb[i]))));
+            eSpin = std::max(eSpin, quatAngle(slerp(qa[i], -qa[i], .5f), qa[i]));     // q and -q: no spin
+        }
+        printf("  end points %.3g rad - slerp(q, -q) %.3g rad\n", eEnds, eSpin);
+        ok &= check(eEnds < BOUND_ENDS && eSpin < BOUND_ENDS, "end points, q and -q same rotation");
+    }
+
+    // batch == single call
+    {
+        const size_t count = std::min<size_t>(samples, 100000);
+        std::vector<quat> bs(count), bn(count);
+        slerp(qa.data(), qb.data(), .3f, bs.data(), count);
+        nlerp(qa.data(), qb.data(), .3f, bn.data(), count);
+        double es = 0, en = 0;
+        for(size_t i = 0; i < count; i++) { es = std::max(es, diffQ(bs[i], slerp(qa[i], qb[i], .3f))); en = std::max(en, diffQ(bn[i], nlerp(qa[i], qb[i], .3f))); }
+        ok &= check(es == 0 && en < 1e-6, "batch slerp identical, batch nlerp same as single (rounding)");
+    }
+
+#if defined(VGM_TEST_WITH_GLM)
+    // GLM: same definitions (glm::slerp shortest path, glm::squad, glm::intermediate)
+    {
+        double eLog = 0, eExp = 0, ePow = 0, eSlerp = 0, eSquad = 0;
+        for(int i = 0; i < samples; i++) {
+            const quat &x = qa[i], &y = qb[i];
+            const float t = ta[i];
+            eLog   = std::max(eLog  , diffQ(log(x), fromGlm(glm::log(toGlm(x)))));
+            const quat l(log(y) * .7f);
+            eExp   = std::max(eExp  , diffQ(exp(l), fromGlm(glm::exp(toGlm(l)))));
+            ePow   = std::max(ePow  , diffQ(pow(x, t), fromGlm(glm::pow(toGlm(x), t))));
+            eSlerp = std::max(eSlerp, diffQ(slerp(x, y, t), fromGlm(glm::slerp(toGlm(x), toGlm(y), t))));
+            const quat &k1 = ka[i], &k2 = kb[i];
+            const glm::quat g1 = glm::intermediate(toGlm(qd[i]), toGlm(k1), toGlm(k2)), g2 = glm::intermediate(toGlm(k1), toGlm(k2), toGlm(qc[i]));
+            eSquad = std::max(eSquad, diffQ(squad(k1, k2, intermediate(qd[i], k1, k2), intermediate(k1, k2, qc[i]), t),
+                                            fromGlm(glm::squad(toGlm(k1), toGlm(k2), g1, g2, t))));
+        }
+        printf("max difference vs GLM\n  log %.3g - exp %.3g - pow %.3g - slerp %.3g - squad %.3g\n", eLog, eExp, ePow, eSlerp, eSquad);
+        ok &= check(eLog < 2 * BOUND_LOG && eExp < 2 * BOUND_LOG && ePow < 2 * BOUND_LOG, "log / exp / pow == glm");
+        ok &= check(eSlerp < 2 * BOUND_SLERP, "slerp == glm::slerp");
+        ok &= check(eSquad < 2 * BOUND_SQUAD, "squad + intermediate == glm::squad + glm::intermediate");
+    }
+#else
+    printf("GLM not found: comparison with glm skipped\n");
+#endif
+
+    // throughput: ns for element (best of 5)
+    {
+        using clk = std::chrono::steady_clock;
+        const size_t count = std::min<size_t>(samples, 1 << 16);
+        std::vector<quat> out(count), s1(count), s2(count);
+        for(size_t i = 0; i < count; i++) { s1[i] = intermediate(qd[i], ka[i], kb[i]); s2[i] = intermediate(ka[i], kb[i], qc[i]); }
+        auto best = [&](auto &&func) {
+            double t = 1e30;
+            for(int r = 0; r < 5; r++) {
+                const auto t0 = clk::now(); func(); const auto t1 = clk::now();
+                t = std::min(t, std::chrono::duration<double, std::nano>(t1 - t0).count() / count);
+            }
+            return t;
+        };
+        struct result { const char *name; double vgm, glm; } res[] = {
+            { "log"         , best([&] { for(size_t i = 0; i < count; i++) out[i] = log(qa[i]); }), 0 },
+            { "exp"         , best([&] { for(size_t i = 0; i < count; i++) out[i] = exp(qa[i]); }), 0 },
+            { "slerp"       , best([&] { for(size_t i = 0; i < count; i++) out[i] = slerp(qa[i], qb[i], ta[i]); }), 0 },
+            { "nlerp"       , best([&] { for(size_t i = 0; i < count; i++) out[i] = nlerp(qa[i], qb[i], ta[i]); }), 0 },
+            { "squad"       , best([&] { for(size_t i = 0; i < count; i++) out[i] = squad(ka[i], kb[i], s1[i], s2[i], ta[i]); }), 0 },
+            { "slerp batch" , best([&] { slerp(qa.data(), qb.data(), .3f, out.data(), count); }), 0 },
+            { "nlerp batch" , best([&] { nlerp(qa.data(), qb.data(), .3f, out.data(), count); }), 0 },
+        };
+#if defined(VGM_TEST_WITH_GLM)
+        std::vector<glm::quat> ga(count), gb(count), gk1(count), gk2(count), g1(count), g2(count), gOut(count);
+        for(size_t i = 0; i < count; i++) { ga[i] = toGlm(qa[i]); gb[i] = toGlm(qb[i]); gk1[i] = toGlm(ka[i]); gk2[i] = toGlm(kb[i]); g1[i] = toGlm(s1[i]); g2[i] = toGlm(s2[i]); }
+        res[0].glm = best([&] { for(size_t i = 0; i < count; i++) gOut[i] = glm::log(ga[i]); });
+        res[1].glm = best([&] { for(size_t i = 0; i < count; i++) gOut[i] = glm::exp(ga[i]); });
+        res[2].glm = best([&] { for(size_t i = 0; i < count; i++) gOut[i] = glm::slerp(ga[i], gb[i], ta[i]); });
+        res[4].glm = best([&] { for(size_t i = 0; i < count; i++) gOut[i] = glm::squad(gk1[i], gk2[i], g1[i], g2[i], ta[i]); });
+#endif
+        printf("%-12s %8s %8s  (ns/element)\n", "", "vgMath", "glm");
+        for(const result &r : res) {
+            if(r.glm > 0) printf("%-12s %8.2f %8.2f\n", r.name, r.vgm, r.glm);
+            else          printf("%-12s %8.2f %8s\n", r.name, r.vgm, "-");
+        }
+    }
+
+    printf("%s\n", ok ? "PASSED" : "FAILED");
+    return ok ? EXIT_SUCCESS : EXIT_FAILURE;
+}
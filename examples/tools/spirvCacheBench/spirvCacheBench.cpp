@@ -0,0 +1,118 @@
+//------------------------------------------------------------------------------
+//  Copyright (c) 2025 Michele Morrone
+//  All rights reserved.
+//
+//  https://michelemorrone.eu - https://brutpitt.com
+//
+//  X: https://x.com/BrutPitt - GitHub: https://github.com/BrutPitt
+//
+//  direct mail: brutpitt(at)gmail.com - me(at)michelemorrone.eu
+//
+//  This software is distributed under the terms of the BSD 2-Clause license
+//------------------------------------------------------------------------------
+//
+//  Startup cost of shader compilation with the on-disk SPIR-V cache
+//  (commons/utils/spirvCache.h): cold vs warm
+//
+//      cold ==> empty cache dir: shaderc compiles and writes the cache files
+//      warm ==> same sources: SPIR-V read from cache (header + payload hash)
+//  each run with a new shaderc::Compiler, as at application startup
+//  checks: warm SPIR-V == cold SPIR-V, one file for shader, new key (miss)
+//  with another optimization level
+//
+//  Only the SPIR-V stage is timed: vkCreateShaderModule is the same in
+//  both cases and doesn't need a device here
+//
+//  usage: spirvCacheBench [-n runs] [vertex.vert fragment.frag]
+//------------------------------------------------------------------------------
+#include <vector>
+#include <string>
+#include <algorithm>
+#include <chrono>
+#include <fstream>
+#include <sstream>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <filesystem>
+
+#include "utils/spirvCache.h"
+
+#define STRING2(x) #x
+#define STRING(x) STRING2(x)
+
+static bool check(bool ok, const char *what)
+{
+    printf("  %s: %s\n", ok ? "ok  " : "FAIL", what);
+    return ok;
+}
+
+static std::string readText(const char *name)
+{
+    std::ifstream file(name);
+    std::stringstream ss;
+    ss << file.rdbuf();
+    return ss.str();
+}
+
+static size_t cacheFiles(const char *dir)
+{
+    std::error_code ec;
+    size_t n = 0;
+    for(auto it = std::filesystem::directory_iterator(dir, ec); !ec && it != std::filesystem::directory_iterator(); it.increment(ec))
+        n += it->path().extension() == ".spv";
+    return n;
+}
+
+int main(int argc, char **argv)
+{
+    int runs = 10;
+    std::string vertName = STRING(APP_SHADERS_DIR) "/vkLightCube.vert", fragName = STRING(APP_SHADERS_DIR) "/vkLightCube.frag";
+    for(int a = 1; a < argc; a++) {
+        if(!strcmp(argv[a], "-n") && a < argc - 1) runs = atoi(argv[++a]);
+        else if(a < argc - 1) { vertName = argv[a]; fragName = argv[++a]; }
+    }
+    const std::string vert = readText(vertName.c_str()), frag = readText(fragName.c_str());
+    if(runs <= 0 || vert.empty() || frag.empty()) { fprintf(stderr, "usage: %s [-n runs] [vertex.vert fragment.frag]\n", argv[0]); return EXIT_FAILURE; }
+
+    const char *cacheDir = "spirvCacheBench.cache";
+    const shaderc_optimization_level optLevel = shaderc_optimization_level_performance;
+    using clk = std::chrono::steady_clock;
+    auto msFor = [](clk::time_point a, clk::time_point b) { return std::chrono::duration<double, std::milli>(b - a).count(); };
+    auto compileBoth = [&](std::vector<uint32_t> &v, std::vector<uint32_t> &f, shaderc_optimization_level level) {
+        shaderc::Compiler compiler;
+        v = spirvCache::compile(compiler, vert.c_str(), shaderc_glsl_vertex_shader  , "vertex shader"  , level, cacheDir);
+        f = spirvCache::compile(compiler, frag.c_str(), shaderc_glsl_fragment_shader, "fragment shader", level, cacheDir);
+    };
+
+    printf("compiler id: \"%s\" - %s + %s\n", SPIRV_CACHE_COMPILER_ID, vertName.c_str(), fragName.c_str());
+    bool ok = true, same = true;
+    std::vector<double> cold, warm;
+    std::error_code ec;
+    for(int r = 0; r < runs; r++) {
+        std::filesystem::remove_all(cacheDir, ec);
+        std::vector<uint32_t> v0, f0, v1, f1;
+        auto t0 = clk::now();
+        compileBoth(v0, f0, optLevel);
+        auto t1 = clk::now();
+        compileBoth(v1, f1, optLevel);
+        auto t2 = clk::now();
+        cold.push_back(msFor(t0, t1)); warm.push_back(msFor(t1, t2));
+        same &= !v0.empty() && !f0.empty() && v0 == v1 && f0 == f1;
+    }
+    ok &= check(same, "warm SPIR-V identical to cold (compiled) SPIR-V");
+    ok &= check(cacheFiles(cacheDir) == 2, "one cache file for shader");
+    {
+        std::vector<uint32_t> v, f;
+        compileBoth(v, f, shaderc_optimization_level_zero);
+        ok &= check(cacheFiles(cacheDir) == 4, "other optimization level ==> other keys (miss)");
+    }
+    std::filesystem::remove_all(cacheDir, ec);
+
+    std::sort(cold.begin(), cold.end()); std::sort(warm.begin(), warm.end());
+    const double c = cold[cold.size() / 2], w = warm[warm.size() / 2];
+    printf("vertex + fragment, median of %d runs: cold %.2f ms - warm %.3f ms (x%.0f)\n", runs, c, w, c / w);
+
+    printf("%s\n", ok ? "PASSED" : "FAILED");
+    return ok ? EXIT_SUCCESS : EXIT_FAILURE;
+}
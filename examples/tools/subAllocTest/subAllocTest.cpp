@@ -0,0 +1,156 @@
+//------------------------------------------------------------------------------
+//  Copyright (c) 2025 Michele Morrone
+//  All rights reserved.
+//
+//  https://michelemorrone.eu - https://brutpitt.com
+//
+//  X: https://x.com/BrutPitt - GitHub: https://github.com/BrutPitt
+//
+//  direct mail: brutpitt(at)gmail.com - me(at)michelemorrone.eu
+//
+//  This software is distributed under the terms of the BSD 2-Clause license
+//------------------------------------------------------------------------------
+//
+//  Headless test of device memory sub-allocator (commons/utils/subAllocator.h),
+//  used by memoryPool / bufferSet / stagingRing in Vulkan example (no GPU needed)
+//
+//      random alloc/free ==> ranges aligned, never overlapped, used bytes exact,
+//                            all coalesced in one free range at end
+//      block full        ==> alloc fails, no partial state
+//      many buffers      ==> memory blocks (vkAllocateMemory) vs one for buffer
+//      stridedCopy       ==> scatter to strided layout and gather back, bytes between
+//                            elements untouched, throughput vs memcpy
+//
+//  usage: subAllocTest [-n operations] [-s seed]
+//------------------------------------------------------------------------------
+#include <vector>
+#include <map>
+#include <random>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+#include "utils/subAllocator.h"
+
+static bool check(bool ok, const char *what)
+{
+    printf("  %s: %s\n", ok ? "ok  " : "FAIL", what);
+    return ok;
+}
+
+int main(int argc, char **argv)
+{
+    int operations = 200000;
+    uint32_t seed = 1;
+    for(int a = 1; a < argc - 1; a++) {
+        if     (!strcmp(argv[a], "-n")) operations = atoi(argv[++a]);
+        else if(!strcmp(argv[a], "-s")) seed       = uint32_t(atoi(argv[++a]));
+    }
+    if(operations <= 0) { fprintf(stderr, "usage: %s [-n operations] [-s seed]\n", argv[0]); return EXIT_FAILURE; }
+
+    std::mt19937 rng(seed);
+    bool ok = true;
+
+    // random alloc/free in a 16 MB block
+    {
+        const uint64_t blockSize = 16 << 20;
+        subAlloc::block b(blockSize);
+        std::map<uint64_t, uint64_t> live;     // offset ==> size
+        std::uniform_int_distribution<uint64_t> size(1, 64 << 10);
+        std::uniform_int_distribution<int> alignExp(0, 8), coin(0, 99);
+        bool aligned = true, overlap = false, accounted = true;
+        uint64_t liveBytes = 0, failed = 0, peak = 0;
+        for(int i = 0; i < operations; i++) {
+            if(live.empty() || coin(rng) < 55) {
+                const uint64_t sz = size(rng), al = uint64_t(1) << alignExp(rng);
+                uint64_t offset;
+                if(!b.alloc(sz, al, offset)) { failed++; continue; }
+                aligned &= !(offset & (al - 1)) && offset + sz <= blockSize;
+                auto next = live.lower_bound(offset);
+                if(next != live.end() && offset + sz > next->first) overlap = true;
+                if(next != live.begin() && std::prev(next)->first + std::prev(next)->second > offset) overlap = true;
+                live[offset] = sz; liveBytes += sz;
+            } else {
+                auto it = live.begin();
+                std::advance(it, std::uniform_int_distribution<size_t>(0, live.size() - 1)(rng));
+                b.free(it->first, it->second);
+                liveBytes -= it->second; live.erase(it);
+            }
+            accounted &= b.used() == liveBytes && b.allocs() == live.size();
+            peak = std::max(peak, liveBytes);
+        }
+        printf("random   %d operations - %llu failed (full) - peak %.1f MB - %zu free ranges with %zu live\n", operations,
+               (unsigned long long) failed, peak / (1024. * 1024.), b.freeRanges(), live.size());
+        ok &= check(aligned, "ranges aligned and inside block");
+        ok &= check(!overlap, "no overlapped ranges");
+        ok &= check(accounted, "used bytes and allocations count exact");
+        for(auto &l : live) b.free(l.first, l.second);
+        ok &= check(b.empty() && b.freeRanges() == 1 && b.largestFree() == blockSize, "all freed ==> one coalesced free range");
+    }
+
+    // block full: alloc fails and leaves the block unchanged
+    {
+        subAlloc::block b(1024);
+        uint64_t o1, o2, o3;
+        const bool a1 = b.alloc(600, 256, o1), a2 = b.alloc(300, 256, o2), a3 = b.alloc(256, 256, o3);
+        ok &= check(a1 && !a2 && a3 && o1 == 0 && o3 == 768 && b.used() == 856, "full block: alloc fails, padding stays free");
+        uint64_t o4;
+        ok &= check(b.alloc(168, 1, o4) && o4 == 600, "alignment padding reused");
+    }
+
+    // many buffers: one vkAllocateMemory each (old bufferSet) vs 16 MB blocks (memoryPool)
+    {
+        const uint64_t blockSize = 16 << 20;
+        std::uniform_int_distribution<uint64_t> size(256, 256 << 10);
+        const int nBuffers = 2000;
+        std::vector<subAlloc::block> blocks;
+        for(int i = 0; i < nBuffers; i++) {
+            const uint64_t sz = size(rng);
+            uint64_t offset;
+            bool done = false;
+            for(auto &b : blocks) if((done = b.alloc(sz, 256, offset))) break;
+            if(!done) { blocks.emplace_back(std::max(blockSize, sz)); blocks.back().alloc(sz, 256, offset); }
+        }
+        uint64_t used = 0, total = 0;
+        for(auto &b : blocks) { used += b.used(); total += b.size(); }
+        printf("buffers  %d (256 B .. 256 KB): device allocations %d ==> %zu, blocks usage %.1f%%\n", nBuffers, nBuffers, blocks.size(), 100. * used / total);
+        ok &= check(blocks.size() * 64 < size_t(nBuffers), "device allocations reduced");
+    }
+
+    // stridedCopy: one attribute (float4) inside interleaved vertices (3 x float4, as vertexPNC)
+    {
+        const uint64_t elem = 16, stride = 48, count = 1 << 20;
+        std::vector<uint8_t> packed(elem * count), vtx(stride * count, 0xAA), back(elem * count), flat(elem * count);
+        for(size_t i = 0; i < packed.size(); i++) packed[i] = uint8_t(i * 7 + 3);
+
+        // best of 5 (warm caches)
+        using clk = std::chrono::steady_clock;
+        double tScatter = 1e30, tGather = 1e30, tPacked = 1e30;
+        auto best = [](double &t, clk::time_point a, clk::time_point b) { t = std::min(t, std::chrono::duration<double>(b - a).count()); };
+        for(int r = 0; r < 5; r++) {
+            auto t0 = clk::now();
+            subAlloc::stridedCopy(vtx.data() + elem, stride, packed.data(), elem, elem, count);     // scatter @ offset 16 (normal)
+            auto t1 = clk::now();
+            subAlloc::stridedCopy(back.data(), elem, vtx.data() + elem, stride, elem, count);       // gather
+            auto t2 = clk::now();
+            subAlloc::stridedCopy(flat.data(), elem, packed.data(), elem, elem, count);             // packed ==> memcpy
+            auto t3 = clk::now();
+            best(tScatter, t0, t1); best(tGather, t1, t2); best(tPacked, t2, t3);
+        }
+
+        bool untouched = true;
+        for(uint64_t i = 0; i < count; i++)
+            for(uint64_t k = 0; k < stride; k++)
+                if((k < elem || k >= 2 * elem) && vtx[i * stride + k] != 0xAA) untouched = false;
+        auto mbs = [&](double t) { return (elem * count / (1024. * 1024.)) / t; };
+        printf("strided  %llu elements of %llu bytes, stride %llu: scatter %.0f MB/s - gather %.0f MB/s - packed (memcpy) %.0f MB/s\n",
+               (unsigned long long) count, (unsigned long long) elem, (unsigned long long) stride, mbs(tScatter), mbs(tGather), mbs(tPacked));
+        ok &= check(back == packed, "scatter + gather round trip");
+        ok &= check(untouched, "interleaved bytes between elements untouched");
+        ok &= check(flat == packed, "packed copy");
+    }
+
+    printf("%s\n", ok ? "PASSED" : "FAILED");
+    return ok ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,219 @@
+//------------------------------------------------------------------------------
+//  Copyright (c) 2025 Michele Morrone
+//  All rights reserved.
+//
+//  https://michelemorrone.eu - https://brutpitt.com
+//
+//  X: https://x.com/BrutPitt - GitHub: https://github.com/BrutPitt
+//
+//  direct mail: brutpitt(at)gmail.com - me(at)michelemorrone.eu
+//
+//  This software is distributed under the terms of the BSD 2-Clause license
+//------------------------------------------------------------------------------
+//
+//  Headless input trace player (no window, no GPU)
+//
+//  Replays a trace recorded by examples (VGIZMO_TRACE_RECORD=fileName) frame
+//  by frame: vGizmo3D events are sent to a vGizmo3D and ImGui input drives
+//  the same main widgets of vkLightCube (ImGui::gizmo3D: rotation + light,
+//  pan & dolly, light direction)
+//
+//  Output: per frame timings (min / avg / median / p99 / max) and a hash of
+//  the final state (vGizmo3D rotations/position + widgets values)
+//
+//  usage: tracePlayer trace.vgtr [-r repeat] [-e expectedHash] [-t timings.csv] [-p trace.json]
+//      -r repeat       ==> replay N times (timings of all, hash must be identical)
+//      -e expectedHash ==> exit code EXIT_FAILURE if final hash is different
+//      -t timings.csv  ==> write frame, events, microseconds of every frame
+//      -p trace.json   ==> zones of vGizmo3D / widgets as Chrome trace-event JSON
+//                          (Perfetto), only if built with VGIZMO_TRACE_EVENTS
+//
+//  N.B. app side changes of the state (e.g. other widgets) are not in the trace:
+//  the hash is reproducible for the trace, to compare different builds/changes
+//------------------------------------------------------------------------------
+#include <vector>
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <cfloat>
+
+#include <imguizmo_quat.h>
+#include "utils/inputTrace.h"
+
+using namespace inputTrace;
+
+struct playerState {
+    vg::vGizmo3D track;
+    vec3 lightPos { 1.f, 0.f, 0.f };
+    float width = 1280, height = 800;
+};
+
+// same conversions used in vkLightCube: lightPos <==> secondary rotation
+static vec3 getLightPosFromQuat(quat &q, float centerDistance) { return (q * vec3(-1.0f, 0.0f, 0.0f)) * centerDistance; }
+static quat getQuatRotFromVec3(vec3 &lPos) {
+    return normalize(angleAxis(acosf(-lPos.x/length(lPos)), normalize(vec3(FLT_EPSILON, lPos.z, -lPos.y))));
+}
+
+// main widgets of vkLightCube (commons/widgets/uiMainDlg.cpp): right aligned, fixed layout
+static void renderWidgets(playerState &st)
+{
+    float widgetSize = 240;
+    ImGui::SetNextWindowSize(ImVec2(widgetSize, st.height), ImGuiCond_Always);
+    ImGui::SetNextWindowPos(ImVec2(st.width-widgetSize, 0), ImGuiCond_Always);
+    ImGui::Begin("##giz", nullptr, ImGuiWindowFlags_NoTitleBar | ImGuiWindowFlags_NoResize | ImGuiWindowFlags_NoScrollbar);
+
+    ImGui::gizmo3D("##aaa", st.track.refRotation(), st.lightPos, widgetSize);
+    widgetSize *= .5;
+    ImGui::gizmo3D("Pan & Dolly", st.track.refPosition(), st.track.refRotation(), widgetSize);
+    ImGui::SameLine();
+    ImGui::gizmo3D("##Dir1", st.lightPos, widgetSize, imguiGizmo::sphereAtOrigin);
+
+    ImGui::End();
+}
+
+static void setImGuiInput(const traceEvent &ev)
+{
+    ImGuiIO &io = ImGui::GetIO();
+    io.AddKeyEvent(ImGuiMod_Ctrl,  (ev.mods & (ImGuiMod_Ctrl  >> 12)) != 0);
+    io.AddKeyEvent(ImGuiMod_Shift, (ev.mods & (ImGuiMod_Shift >> 12)) != 0);
+    io.AddKeyEvent(ImGuiMod_Alt,   (ev.mods & (ImGuiMod_Alt   >> 12)) != 0);
+    io.AddKeyEvent(ImGuiMod_Super, (ev.mods & (ImGuiMod_Super >> 12)) != 0);
+    io.AddMousePosEvent(ev.x, ev.y);
+    for(int i = 0; i < 5; i++) io.AddMouseButtonEvent(i, (ev.button & (1 << i)) != 0);
+    if(ev.dx != 0.f || ev.dy != 0.f) io.AddMouseWheelEvent(ev.dy, ev.dx);
+}
+
+static uint64_t stateHash(playerState &st)
+{
+    const quat q = st.track.getRotation(), qs = st.track.getSecondRot();
+    const vec3 p = st.track.getPosition();
+    uint64_t h = fnv1a(&q, sizeof(q));
+    h = fnv1a(&qs, sizeof(qs), h);
+    h = fnv1a(&p, sizeof(p), h);
+    return fnv1a(&st.lightPos, sizeof(st.lightPos), h);
+}
+
+// replay all trace: return final state hash, append frame timings (microseconds)
+static uint64_t play(const std::vector<traceEvent> &events, std::vector<float> &frameUs, std::vector<uint32_t> &frameEvents)
+{
+    ImGui::CreateContext();
+    ImGuiIO &io = ImGui::GetIO();
+    io.IniFilename = nullptr;
+    io.LogFilename = nullptr;
+    unsigned char *pixels; int texW, texH;
+    io.Fonts->GetTexDataAsRGBA32(&pixels, &texW, &texH);     // headless: build atlas only
+
+    // imGuIZMO: same settings of vkLightCube
+    imguiGizmo::setGizmoFeelingRot(.75f);
+    imguiGizmo::setPanScale(.5f);
+    imguiGizmo::setDollyScale(.5f);
+    imguiGizmo::setDollyWheelScale(.5f);
+    imguiGizmo::setPanModifier(vg::evSuperModifier);
+    imguiGizmo::setDollyModifier(vg::evControlModifier);
+
+    playerState st;
+    st.track.setGizmoRotControl      (vg::evButton1, 0);
+    st.track.setGizmoRotXControl     (vg::evButton1, vg::evShiftModifier);
+    st.track.setGizmoRotYControl     (vg::evButton1, vg::evControlModifier);
+    st.track.setGizmoRotZControl     (vg::evButton1, vg::evAltModifier | vg::evSuperModifier);
+    st.track.setGizmoSecondRotControl(vg::evButton2, 0);
+    st.track.setDollyControl         (vg::evButton2, vg::evControlModifier);
+    st.track.setPanControl           (vg::evButton2, vg::evShiftModifier);
+
+    // ImGui input recorded in frame N (before ImGui::NewFrame) is the input processed
+    // in frame N-1 ==> it is sent to ImGui::NewFrame of frame N-1
+    auto nextImGuiInput = [&](size_t i) -> const traceEvent * {
+        const uint32_t frame = events[i].frame;
+        for(; i < events.size() && events[i].frame <= frame + 1; i++)
+            if(events[i].type == evImGuiFrame && events[i].frame == frame + 1) return &events[i];
+        return nullptr;
+    };
+
+    size_t i = 0;
+    while(i < events.size()) {
+        const uint32_t frame = events[i].frame;
+        const auto start = std::chrono::steady_clock::now();
+
+        const traceEvent *imguiInput = nextImGuiInput(i);
+        uint32_t count = 0;
+        for(; i < events.size() && events[i].frame == frame; i++, count++) {
+            const traceEvent &ev = events[i];
+            if(ev.type == evViewport) { st.width = ev.x; st.height = ev.y; }
+            apply(st.track, ev);
+        }
+        if(frame == 0) continue;    // initial state (before first frame)
+
+        io.DisplaySize = ImVec2(st.width, st.height);
+        io.DeltaTime = 1.f/60.f;
+        if(imguiInput) setImGuiInput(*imguiInput);
+
+        ImGui::NewFrame();
+        st.lightPos = getLightPosFromQuat(st.track.refSecondRot(), 1.f);
+        renderWidgets(st);
+        st.track.setSecondRot(getQuatRotFromVec3(st.lightPos));
+        ImGui::Render();
+
+        frameUs.push_back(std::chrono::duration<float, std::micro>(std::chrono::steady_clock::now() - start).count());
+        frameEvents.push_back(count);
+    }
+
+    const uint64_t h = stateHash(st);
+    ImGui::DestroyContext();
+    return h;
+}
+
+int main(int argc, char **argv)
+{
+    if(argc < 2) { fprintf(stderr, "usage: %s trace.vgtr [-r repeat] [-e expectedHash] [-t timings.csv] [-p trace.json]\n", argv[0]); return EXIT_FAILURE; }
+
+    int repeat = 1;
+    const char *expected = nullptr, *csvFile = nullptr, *traceFile = nullptr;
+    for(int a = 2; a < argc - 1; a++) {
+        if     (!strcmp(argv[a], "-r")) repeat   = std::max(1, atoi(argv[++a]));
+        else if(!strcmp(argv[a], "-e")) expected = argv[++a];
+        else if(!strcmp(argv[a], "-t")) csvFile  = argv[++a];
+        else if(!strcmp(argv[a], "-p")) traceFile = argv[++a];
+    }
+
+    std::vector<traceEvent> events;
+    if(!load(argv[1], events) || events.empty()) { fprintf(stderr, "%s: not a valid trace\n", argv[1]); return EXIT_FAILURE; }
+
+    std::vector<float> frameUs;
+    std::vector<uint32_t> frameEvents;
+    uint64_t finalHash = 0;
+    for(int r = 0; r < repeat; r++) {
+        const uint64_t h = play(events, frameUs, frameEvents);
+        if(r && h != finalHash) { fprintf(stderr, "replay %d: hash %016llx != %016llx (not deterministic)\n", r, (unsigned long long) h, (unsigned long long) finalHash); return EXIT_FAILURE; }
+        finalHash = h;
+    }
+
+    if(csvFile) {
+        if(FILE *f = fopen(csvFile, "w")) {
+            fprintf(f, "frame,events,us\n");
+            for(size_t n = 0; n < frameUs.size(); n++) fprintf(f, "%zu,%u,%.2f\n", n, frameEvents[n], frameUs[n]);
+            fclose(f);
+        }
+    }
+
+    if(traceFile) {
+#if defined(VGIZMO_TRACE_EVENTS)
+        if(!vgTrace::writeChromeJson(traceFile)) fprintf(stderr, "%s: can't be written\n", traceFile);
+#else
+        fprintf(stderr, "-p %s: build with VGIZMO_TRACE_EVENTS to record trace events\n", traceFile);
+#endif
+    }
+
+    std::vector<float> sorted(frameUs);
+    std::sort(sorted.begin(), sorted.end());
+    double sum = 0; for(float t : sorted) sum += t;
+    const size_t n = sorted.size();
+    printf("events: %zu - frames: %zu x %d\n", events.size(), n / repeat, repeat);
+    if(n) printf("frame us: min %.2f - avg %.2f - median %.2f - p99 %.2f - max %.2f\n",
+                 sorted[0], sum / n, sorted[n / 2], sorted[std::min(n - 1, n * 99 / 100)], sorted[n - 1]);
+    printf("hash: %016llx\n", (unsigned long long) finalHash);
+
+    if(expected && strtoull(expected, nullptr, 16) != finalHash) { fprintf(stderr, "hash mismatch: expected %s\n", expected); return EXIT_FAILURE; }
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,157 @@
+//------------------------------------------------------------------------------
+//  Copyright (c) 2025 Michele Morrone
+//  All rights reserved.
+//
+//  https://michelemorrone.eu - https://brutpitt.com
+//
+//  X: https://x.com/BrutPitt - GitHub: https://github.com/BrutPitt
+//
+//  direct mail: brutpitt(at)gmail.com - me(at)michelemorrone.eu
+//
+//  This software is distributed under the terms of the BSD 2-Clause license
+//------------------------------------------------------------------------------
+//
+//  Headless test of vgMath packing / quantization (vgMath.h)
+//
+//  Random unit quaternions and directions (uniform on sphere), max error of
+//  pack ==> unpack round trip against the bounds documented in vgMath.h:
+//      packQuat32/48/64 ==> angle of q^-1 * unpacked (q and -q same rotation)
+//      packOct2x16/2x8  ==> angle between direction and unpacked direction
+//      packHalf         ==> relative error (binary16: 2^-11), special values
+//
+//  Then throughput of batch overloads (pointer, pointer, count): M elements/s
+//
+//  usage: vgPackTest [-n samples] [-s seed]
+//------------------------------------------------------------------------------
+#include <vector>
+#include <algorithm>
+#include <chrono>
+#include <random>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+#include <vgMath.h>
+
+static bool check(bool ok, const char *what)
+{
+    printf("  %s: %s\n", ok ? "ok  " : "FAIL", what);
+    return ok;
+}
+
+static double degrees(double rad) { return rad * 180.0 / 3.14159265358979323846; }
+
+// rotation angle between two quats (double: error of measure << quantization)
+static double quatAngle(const quat &a, const quat &b)
+{
+    const double d = std::fabs(double(a.w) * b.w + double(a.x) * b.x + double(a.y) * b.y + double(a.z) * b.z) /
+                     std::sqrt((double(a.w) * a.w + double(a.x) * a.x + double(a.y) * a.y + double(a.z) * a.z) *
+                               (double(b.w) * b.w + double(b.x) * b.x + double(b.y) * b.y + double(b.z) * b.z));
+    return degrees(2.0 * std::acos(std::min(1.0, d)));
+}
+static double dirAngle(const vec3 &a, const vec3 &b)
+{
+    const double d = (double(a.x) * b.x + double(a.y) * b.y + double(a.z) * b.z) /
+                     std::sqrt((double(a.x) * a.x + double(a.y) * a.y + double(a.z) * a.z) * (double(b.x) * b.x + double(b.y) * b.y + double(b.z) * b.z));
+    return degrees(std::acos(std::max(-1.0, std::min(1.0, d))));
+}
+
+int main(int argc, char **argv)
+{
+    int samples = 2000000; uint32_t seed = 1;
+    for(int a = 1; a < argc - 1; a++) {
+        if     (!strcmp(argv[a], "-n")) samples = atoi(argv[++a]);
+        else if(!strcmp(argv[a], "-s")) seed    = uint32_t(atoi(argv[++a]));
+    }
+    if(samples <= 0) { fprintf(stderr, "usage: %s [-n samples] [-s seed]\n", argv[0]); return EXIT_FAILURE; }
+
+    std::mt19937 rng(seed);
+    std::normal_distribution<float> g(0.f, 1.f);     // normalized gaussian ==> uniform on sphere
+    std::vector<quat> quats(samples);
+    std::vector<vec3> dirs(samples);
+    for(auto &q : quats) q = normalize(quat(g(rng), g(rng), g(rng), g(rng)));
+    for(auto &d : dirs)  d = normalize(vec3(g(rng), g(rng), g(rng)));
+    bool ok = true;
+
+    // error bounds: documented in vgMath.h "packing / quantization"
+    {
+        double e32 = 0, e48 = 0, e64 = 0, eOct16 = 0, eOct8 = 0;
+        for(int i = 0; i < samples; i++) {
+            const quat &q = quats[i];
+            e32 = std::max(e32, quatAngle(q, unpackQuat32(packQuat32(q))));
+            e48 = std::max(e48, quatAngle(q, unpackQuat48(packQuat48(q))));
+            e64 = std::max(e64, quatAngle(q, unpackQuat64(packQuat64(q))));
+            const vec3 &d = dirs[i];
+            eOct16 = std::max(eOct16, dirAngle(d, unpackOct2x16(packOct2x16(d))));
+            eOct8  = std::max(eOct8 , dirAngle(d, unpackOct2x8 (packOct2x8 (d))));
+        }
+        printf("max angle error (deg) over %d samples\n", samples);
+        printf("  quat32 %.6f - quat48 %.6f - quat64 %.7f - oct2x16 %.6f - oct2x8 %.4f\n", e32, e48, e64, eOct16, eOct8);
+        ok &= check(e32    < .26    , "packQuat32  < 0.26 deg");
+        ok &= check(e48    < .008   , "packQuat48  < 0.008 deg");
+        ok &= check(e64    < .0003  , "packQuat64  < 0.0003 deg");
+        ok &= check(eOct16 < .004   , "packOct2x16 < 0.004 deg");
+        ok &= check(eOct8  < 1.     , "packOct2x8  < 1 deg");
+
+        bool axes = true;   // exact on axes: odd levels, 0 is representable
+        for(const quat &q : { quat(1, 0, 0, 0), quat(0, 1, 0, 0), quat(0, 0, 1, 0), quat(0, 0, 0, 1), quat(-1, 0, 0, 0) })
+            axes &= quatAngle(q, unpackQuat32(packQuat32(q))) == 0.0 && quatAngle(q, unpackQuat64(packQuat64(q))) == 0.0;
+        ok &= check(axes, "packQuat exact on identity and axes (also -q)");
+    }
+
+    // half float: relative error and special values
+    {
+        std::uniform_real_distribution<float> e(-14.f, 15.f);
+        double eRel = 0;
+        for(int i = 0; i < samples; i++) {
+            const float v = std::exp2(e(rng)) * (i & 1 ? -1.f : 1.f);
+            eRel = std::max(eRel, std::fabs(double(unpackHalf1x16(packHalf1x16(v))) - v) / std::fabs(v));
+        }
+        printf("half float max relative error (normal range): %.3g\n", eRel);
+        ok &= check(eRel <= 1.0 / 2048.0, "packHalf1x16 relative error <= 2^-11 (round to nearest)");
+        const bool special = packHalf1x16(0.f) == 0 && packHalf1x16(-0.f) == 0x8000 && packHalf1x16(1.f) == 0x3c00 &&
+                             packHalf1x16(65504.f) == 0x7bff && packHalf1x16(1e6f) == 0x7c00 && packHalf1x16(INFINITY) == 0x7c00 &&
+                             std::isnan(unpackHalf1x16(packHalf1x16(NAN))) && unpackHalf1x16(0x0001) == std::exp2(-24.f);
+        ok &= check(special, "packHalf1x16 zero, max, overflow, Inf, NaN, denormal");
+    }
+
+    // batch throughput, best of 5 (warm caches)
+    {
+        using clk = std::chrono::steady_clock;
+        const size_t count = std::min<size_t>(samples, 1 << 20);
+        std::vector<uint32_t> p32(count), pOct(count);
+        std::vector<uint64_t> p64(count), pHalf(count);
+        std::vector<uint16_t> pOct8(count);
+        std::vector<quat> uq(count);
+        std::vector<vec3> uv(count);
+        std::vector<vec4> v4(count), u4(count);
+        for(size_t i = 0; i < count; i++) v4[i] = vec4(quats[i].x, quats[i].y, quats[i].z, quats[i].w);
+
+        struct result { const char *name; double pack, unpack; };
+        auto best = [&](auto &&func) {
+            double t = 1e30;
+            for(int r = 0; r < 5; r++) {
+                const auto t0 = clk::now(); func(); const auto t1 = clk::now();
+                t = std::min(t, std::chrono::duration<double>(t1 - t0).count());
+            }
+            return count / t * 1e-6;
+        };
+        const result res[] = {
+            { "packQuat32" , best([&] { packQuat32 (quats.data(), p32.data()  , count); }), best([&] { unpackQuat32(p32.data()  , uq.data(), count); }) },
+            { "packQuat64" , best([&] { packQuat64 (quats.data(), p64.data()  , count); }), best([&] { unpackQuat64(p64.data()  , uq.data(), count); }) },
+            { "packOct2x16", best([&] { packOct2x16(dirs.data() , pOct.data() , count); }), best([&] { unpackOct2x16(pOct.data(), uv.data(), count); }) },
+            { "packOct2x8" , best([&] { packOct2x8 (dirs.data() , pOct8.data(), count); }), best([&] { unpackOct2x8(pOct8.data(), uv.data(), count); }) },
+            { "packHalf4x16", best([&] { packHalf4x16(v4.data() , pHalf.data(), count); }), best([&] { unpackHalf4x16(pHalf.data(), u4.data(), count); }) },
+        };
+        printf("batch of %zu elements (M elements/s)\n%-14s %8s %8s\n", count, "", "pack", "unpack");
+        for(const result &r : res) printf("%-14s %8.1f %8.1f\n", r.name, r.pack, r.unpack);
+
+        bool same = true;   // batch == single call
+        for(size_t i = 0; i < count; i += 997) same &= p32[i] == packQuat32(quats[i]) && pOct8[i] == packOct2x8(dirs[i]) && pHalf[i] == packHalf4x16(v4[i]);
+        ok &= check(same, "batch overloads identical to single calls");
+    }
+
+    printf("%s\n", ok ? "PASSED" : "FAILED");
+    return ok ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,262 @@
+//------------------------------------------------------------------------------
+//  Copyright (c) 2025 Michele Morrone
+//  All rights reserved.
+//
+//  https://michelemorrone.eu - https://brutpitt.com
+//
+//  X: https://x.com/BrutPitt - GitHub: https://github.com/BrutPitt
+//
+//  direct mail: brutpitt(at)gmail.com - me(at)michelemorrone.eu
+//
+//  This software is distributed under the terms of the BSD 2-Clause license
+//------------------------------------------------------------------------------
+//
+//  Headless test / benchmark of vGizmo3DGroup (vGizmo3D.h)
+//
+//  64 viewports (8x8) in a 1280x800 window, same event stream (drags with
+//  rotation / secondary rotation / pan / dolly, wheel, immediate mode) on:
+//      broadcast ==> a vGizmo3D for viewport, every event to all of them
+//      routed    ==> a vGizmo3D for viewport, hit-test in the application
+//      group     ==> vGizmo3DGroup (SoA state, one vGizmo3D on event path)
+//  checks:
+//      all viewports == routed vGizmo3D for viewport (exact), immediate mode
+//          one shot in both (resetInput() when not captured)
+//      linked viewports share rotations, pan / dolly independent
+//      buttons outside mask (< 0, >= 32) ignored
+//      group idle() == vGizmo3D::idle() on all viewports (SoA pass, no branches)
+//      idle() during drags (every frame in a render loop): drag goes on
+//  reports us/event and us for idle() of all viewports
+//
+//  usage: viewportGroupBench [-n events]
+//------------------------------------------------------------------------------
+#include <vector>
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+#include <vGizmo3D.h>
+
+static bool check(bool ok, const char *what)
+{
+    printf("  %s: %s\n", ok ? "ok  " : "FAIL", what);
+    return ok;
+}
+
+static const int cols = 8, rows = 8, count = cols * rows;
+static const float winW = 1280, winH = 800, vpW = winW / cols, vpH = winH / rows;
+
+// recorded events in window coords
+struct event { enum { press, release, motion, immediate, wheel } type; vgButtons button; vgModifiers mod; float x, y, dx, dy; };
+
+static std::vector<event> buildEvents(int n)
+{
+    struct drag { vgButtons button; vgModifiers mod; } drags[] = {
+        { vg::evLeftButton , vg::evNoModifier      },   // rotation
+        { vg::evRightButton, vg::evNoModifier      },   // secondary rotation
+        { vg::evRightButton, vg::evControlModifier },   // pan
+        { vg::evRightButton, vg::evShiftModifier   },   // dolly
+    };
+    std::vector<event> ev;
+    ev.reserve(n + 256);
+    for(int d = 0; int(ev.size()) < n; d++) {
+        const drag &g = drags[d % 4];
+        const int v = (d * 37) % count;     // scattered viewports
+        const float cx = (v % cols + .5f) * vpW, cy = (v / cols + .5f) * vpH;
+        if(d % 9 == 8) {        // wheel + immediate mode burst (imGuIZMO style)
+            ev.push_back({ event::wheel, g.button, g.mod, cx, cy, 0, 1 });
+            for(int i = 0; i < 60; i++) ev.push_back({ event::immediate, g.button, g.mod, cx + (i % 40) - 20, cy, 1.5f, -.5f });
+            continue;
+        }
+        ev.push_back({ event::press, g.button, g.mod, cx, cy, 0, 0 });
+        for(int i = 1; i <= 200; i++) ev.push_back({ event::motion, g.button, g.mod, cx + 60.f * std::sin(i * .031f), cy + 35.f * std::sin(i * .047f), 0, 0 });
+        ev.push_back({ event::release, g.button, g.mod, cx, cy, 0, 0 });
+    }
+    return ev;
+}
+
+static void send(vg::vGizmo3D &g, const event &e, float ox, float oy)
+{
+    switch(e.type) {
+        case event::press     : g.mouse(e.button, e.mod, true , e.x - ox, e.y - oy); break;
+        case event::release   : g.mouse(e.button, e.mod, false, e.x - ox, e.y - oy); break;
+        case event::motion    : g.motion(e.x - ox, e.y - oy); break;
+        case event::immediate : g.motionImmediateMode(e.x - ox, e.y - oy, e.dx, e.dy, e.mod); break;
+        case event::wheel     : g.wheel(e.dx, e.dy); break;
+    }
+}
+static void send(vg::vGizmo3DGroup &g, const event &e)
+{
+    switch(e.type) {
+        case event::press     : g.mouse(e.button, e.mod, true , e.x, e.y); break;
+        case event::release   : g.mouse(e.button, e.mod, false, e.x, e.y); break;
+        case event::motion    : g.motion(e.x, e.y); break;
+        case event::immediate : g.motionImmediateMode(e.x, e.y, e.dx, e.dy, e.mod); break;
+        case event::wheel     : g.wheel(e.x, e.y, e.dx, e.dy); break;
+    }
+}
+
+// a vGizmo3D for viewport: all events to all (broadcast) or hit-test in application (routed)
+struct perViewport {
+    std::vector<vg::vGizmo3D> gizmos = std::vector<vg::vGizmo3D>(count);
+    int captured = -1;
+    perViewport() { for(vg::vGizmo3D &g : gizmos) g.viewportSize(vpW, vpH); }
+    static float ox(int i) { return (i % cols) * vpW; }
+    static float oy(int i) { return (i / cols) * vpH; }
+    void broadcast(const event &e) { for(int i = 0; i < count; i++) send(gizmos[i], e, ox(i), oy(i)); }
+    void routed(const event &e) {
+        const int hit = captured >= 0 ? captured : std::min(int(e.y / vpH), rows - 1) * cols + std::min(int(e.x / vpW), cols - 1);
+        if(e.type == event::press) captured = hit;
+        else if(e.type == event::release) captured = -1;
+        send(gizmos[hit], e, ox(hit), oy(hit));
+        if(e.type == event::immediate && captured < 0) gizmos[hit].resetInput();   // one shot, as vGizmo3DGroup
+    }
+    void idle() { for(vg::vGizmo3D &g : gizmos) g.idle(); }
+};
+
+static void addGrid(vg::vGizmo3DGroup &group)
+{
+    for(int i = 0; i < count; i++) group.add(perViewport::ox(i), perViewport::oy(i), vpW, vpH);
+}
+
+template<class Q> static double quatDiff(const Q &a, const Q &b)
+{
+    return std::max(std::max(std::fabs(double(a.w) - b.w), std::fabs(double(a.x) - b.x)), std::max(std::fabs(double(a.y) - b.y), std::fabs(double(a.z) - b.z)));
+}
+template<class Q> static bool sameQuat(const Q &a, const Q &b) { return a.w == b.w && a.x == b.x && a.y == b.y && a.z == b.z; }
+template<class Q> static bool isIdentity(const Q &q) { return q.w == 1 && q.x == 0 && q.y == 0 && q.z == 0; }
+template<class V> static bool sameVec(const V &a, const V &b) { return a.x == b.x && a.y == b.y && a.z == b.z; }
+
+int main(int argc, char **argv)
+{
+    int events = 400000;
+    for(int a = 1; a < argc - 1; a++)
+        if(!strcmp(argv[a], "-n")) events = atoi(argv[++a]);
+    if(events <= 0) { fprintf(stderr, "usage: %s [-n events]\n", argv[0]); return EXIT_FAILURE; }
+
+    const std::vector<event> ev = buildEvents(events);
+    bool ok = true;
+
+    // group == a vGizmo3D for viewport with application routing
+    {
+        vg::vGizmo3DGroup group;
+        addGrid(group);
+        perViewport ref;
+        const std::vector<event> few(ev.begin(), ev.begin() + std::min<size_t>(ev.size(), 50000));
+        for(const event &e : few) { send(group, e); ref.routed(e); }
+        bool same = true;
+        for(int i = 0; i < count; i++)
+            same &= sameQuat(group.getRotation(i), ref.gizmos[i].getRotation()) && sameQuat(group.getSecondRot(i), ref.gizmos[i].getSecondRot()) &&
+                    sameVec(group.getPosition(i), ref.gizmos[i].getPosition());
+        ok &= check(same, "rotations / positions of all viewports == vGizmo3D for viewport");
+
+        // idle: SoA pass == vGizmo3D::idle(), spinning or not
+        double eSpin = 0, eStill = 0;
+        for(int f = 0; f < 1000; f++) { group.idle(); ref.idle(); }
+        int spinning = 0;
+        for(int i = 0; i < count; i++) {
+            const double e = quatDiff(group.getRotation(i), ref.gizmos[i].getRotation());
+            const bool spin = ref.gizmos[i].isIdleRotating();
+            spinning += spin;
+            (spin ? eSpin : eStill) = std::max(spin ? eSpin : eStill, e);
+        }
+        printf("  idle x1000: %d spinning viewports, max diff vs vGizmo3D::idle() %.3g (spinning) %.3g (still)\n", spinning, eSpin, eStill);
+        ok &= check(spinning > 0 && eSpin < 1e-6 && eStill < 1e-6, "group idle() == vGizmo3D::idle() within 1e-6");
+    }
+
+    // idle() every frame during drags (render loop): the drag goes on, same of vGizmo3D for viewport
+    {
+        vg::vGizmo3DGroup group;
+        addGrid(group);
+        group.mouse(vg::evLeftButton, vg::evNoModifier, true, 80, 50);
+        group.motion(90, 55);
+        group.idle();
+        const auto q0 = group.getRotation(0);
+        group.motion(110, 65);
+        const bool rotating = group.isCaptured() && !sameQuat(group.getRotation(0), q0);
+        group.mouse(vg::evLeftButton, vg::evNoModifier, false, 110, 65);
+        group.mouse(vg::evRightButton, vg::evControlModifier, true, 240, 150);    // pan on viewport 9
+        group.motion(245, 150);
+        group.idle();
+        const auto p0 = group.getPosition(9);
+        group.motion(260, 150);
+        const bool panning = group.getPosition(9).x != p0.x && isIdentity(group.getRotation(9));
+        group.mouse(vg::evRightButton, vg::evControlModifier, false, 260, 150);
+        ok &= check(rotating && panning, "idle() during a drag: rotation / pan go on");
+
+        perViewport ref;
+        vg::vGizmo3DGroup idled;
+        addGrid(idled);
+        const std::vector<event> few(ev.begin(), ev.begin() + std::min<size_t>(ev.size(), 50000));
+        double e = 0;
+        for(size_t k = 0; k < few.size(); k++) {
+            send(idled, few[k]); ref.routed(few[k]);
+            if(k % 16 == 15) { idled.idle(); ref.idle(); }
+        }
+        for(int i = 0; i < count; i++) e = std::max(e, quatDiff(idled.getRotation(i), ref.gizmos[i].getRotation()));
+        printf("  idle every 16 events: max diff vs vGizmo3D for viewport %.3g\n", e);
+        ok &= check(e < 1e-4, "idle() between events == vGizmo3D for viewport within 1e-4");
+    }
+
+    // links: shared rotations, independent pan
+    {
+        vg::vGizmo3DGroup group;
+        addGrid(group);
+        group.setLink(0, 1); group.setLink(9, 1);
+        group.mouse(vg::evLeftButton, vg::evNoModifier, true, 80, 50);
+        for(int i = 1; i <= 50; i++) group.motion(80 + i, 50 + i * .5f);
+        group.mouse(vg::evLeftButton, vg::evNoModifier, false, 130, 75);
+        const auto q0 = group.getRotation(0);
+        group.mouse(vg::evRightButton, vg::evControlModifier, true, 240, 150);    // pan on viewport 9
+        for(int i = 1; i <= 20; i++) group.motion(240 + i, 150);
+        group.mouse(vg::evRightButton, vg::evControlModifier, false, 260, 150);
+        const auto p0 = group.getPosition(0), p9 = group.getPosition(9);
+        ok &= check(q0.w != 1 && sameQuat(group.getRotation(9), q0) && isIdentity(group.getRotation(1)), "linked viewports share rotation, unlinked unchanged");
+        ok &= check(p0.x == 0 && p9.x != 0, "pan / dolly independent in linked viewports");
+        for(int f = 0; f < 10; f++) group.idle();
+        ok &= check(sameQuat(group.getRotation(0), group.getRotation(9)), "idle(): followers copy the last active of the link");
+    }
+
+    // buttons outside mask: ignored, no capture
+    {
+        vg::vGizmo3DGroup group;
+        addGrid(group);
+        group.mouse(vgButtons(40), vg::evNoModifier, true, 80, 50);
+        group.mouse(vgButtons(-1), vg::evNoModifier, true, 80, 50);
+        group.motion(120, 70);
+        ok &= check(!group.isCaptured() && group.getActive() < 0 && isIdentity(group.getRotation(0)), "buttons < 0 or >= 32 ignored");
+    }
+
+    // throughput: us/event (best of 5)
+    {
+        using clk = std::chrono::steady_clock;
+        auto best = [&](size_t n, auto &&func) {
+            double t = 1e30;
+            for(int r = 0; r < 5; r++) {
+                const auto t0 = clk::now(); func(); const auto t1 = clk::now();
+                t = std::min(t, std::chrono::duration<double>(t1 - t0).count());
+            }
+            return t / n * 1e6;
+        };
+        perViewport broadcast, routed;
+        vg::vGizmo3DGroup group;
+        addGrid(group);
+        const std::vector<event> few(ev.begin(), ev.begin() + std::min<size_t>(ev.size(), 20000));     // broadcast: 64x the work
+        const double usBroadcast = best(few.size(), [&] { for(const event &e : few) broadcast.broadcast(e); });
+        const double usRouted    = best(ev.size() , [&] { for(const event &e : ev) routed.routed(e); });
+        const double usGroup     = best(ev.size() , [&] { for(const event &e : ev) send(group, e); });
+        const int frames = 20000;
+        const double usIdleRef   = best(frames, [&] { for(int f = 0; f < frames; f++) routed.idle(); });
+        const double usIdleGroup = best(frames, [&] { for(int f = 0; f < frames; f++) group.idle(); });
+        printf("%d viewports, %zu events\n", count, ev.size());
+        printf("%-32s %8.3f us/event\n", "vGizmo3D for viewport, broadcast", usBroadcast);
+        printf("%-32s %8.3f us/event\n", "vGizmo3D for viewport, routed", usRouted);
+        printf("%-32s %8.3f us/event\n", "vGizmo3DGroup", usGroup);
+        printf("idle() of all viewports: vGizmo3D %.3f us - vGizmo3DGroup %.3f us\n", usIdleRef, usIdleGroup);
+    }
+
+    printf("%s\n", ok ? "PASSED" : "FAILED");
+    return ok ? EXIT_SUCCESS : EXIT_FAILURE;
+}
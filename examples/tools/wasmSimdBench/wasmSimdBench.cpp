@@ -0,0 +1,171 @@
+//------------------------------------------------------------------------------
+//  Copyright (c) 2025 Michele Morrone
+//  All rights reserved.
+//
+//  https://michelemorrone.eu - https://brutpitt.com
+//
+//  X: https://x.com/BrutPitt - GitHub: https://github.com/BrutPitt
+//
+//  direct mail: brutpitt(at)gmail.com - me(at)michelemorrone.eu
+//
+//  This software is distributed under the terms of the BSD 2-Clause license
+//------------------------------------------------------------------------------
+//
+//  Headless benchmark of vgMath hot operations (vgMath.h, wasm_simd128 kernels)
+//
+//  Same source for three builds (see CMakeLists.txt): native, scalar wasm and
+//  SIMD wasm (-msimd128), the two wasm builds run by node
+//      mat4 * mat4, mat4 * vec4, quat * quat, quat * vec3 ==> dependent chains
+//      transform  ==> batch q * (v * s) on a gizmo sphere sized array (drawFunc)
+//      per vertex ==> same transform as in drawFunc before batch: one quat * vec3 each
+//
+//  Output: ns for operation, M operations/s and check of results against scalar
+//  reference (same formulas): SIMD kernels must be identical, bit by bit
+//
+//  usage: wasmSimdBench [-n iterations]
+//------------------------------------------------------------------------------
+#include <vector>
+#include <algorithm>
+#include <chrono>
+#include <random>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+#include <vgMath.h>
+
+#if defined(VGM_USES_WASM_SIMD)
+    static const char *buildName = "wasm simd128";
+#elif defined(__wasm__) || defined(__EMSCRIPTEN__)
+    static const char *buildName = "wasm scalar";
+#else
+    static const char *buildName = "native";
+#endif
+
+// scalar reference: same formulas and order of vgMath scalar code
+static quat refMul(const quat &a, const quat &b) {
+    return { a.w * b.w - a.x * b.x - a.y * b.y - a.z * b.z, a.w * b.x + a.x * b.w + a.y * b.z - a.z * b.y,
+             a.w * b.y + a.y * b.w + a.z * b.x - a.x * b.z, a.w * b.z + a.z * b.w + a.x * b.y - a.y * b.x }; }
+static vec3 refMul(const quat &q, const vec3 &v) {
+    const vec3 qV(q.x, q.y, q.z), uv(cross(qV, v));
+    return v + ((uv * q.w) + cross(qV, uv)) * 2.f; }
+static vec4 refMul(const mat4 &m, const vec4 &v) {
+    vec4 r;
+    for(int i = 0; i < 4; i++) r[i] = ((m[0][i] * v.x + m[1][i] * v.y) + m[2][i] * v.z) + m[3][i] * v.w;
+    return r; }
+static mat4 refMul(const mat4 &a, const mat4 &b) {
+    mat4 r;
+    for(int j = 0; j < 4; j++) r[j] = refMul(a, b[j]);
+    return r; }
+
+static bool check(bool ok, const char *what)
+{
+    printf("  %s: %s\n", ok ? "ok  " : "FAIL", what);
+    return ok;
+}
+
+int main(int argc, char **argv)
+{
+    int iterations = 2000000;
+    for(int a = 1; a < argc - 1; a++)
+        if(!strcmp(argv[a], "-n")) iterations = atoi(argv[++a]);
+    if(iterations <= 0) { fprintf(stderr, "usage: %s [-n iterations]\n", argv[0]); return EXIT_FAILURE; }
+
+    std::mt19937 rng(1);
+    std::uniform_real_distribution<float> u(-1.f, 1.f);
+    bool ok = true;
+
+    // correctness: random operands vs scalar reference
+    {
+        int diff = 0;
+        for(int i = 0; i < 100000; i++) {
+            const quat a(u(rng), u(rng), u(rng), u(rng)), b(u(rng), u(rng), u(rng), u(rng));
+            const vec3 v(u(rng), u(rng), u(rng));
+            const vec4 w(u(rng), u(rng), u(rng), u(rng));
+            mat4 m, n;
+            for(int k = 0; k < 16; k++) { (&m.m00)[k] = u(rng); (&n.m00)[k] = u(rng); }
+            const quat qq = a * b, rq = refMul(a, b);
+            const vec3 qv = a * v, rv = refMul(a, v);
+            const vec4 mv = m * w, rw = refMul(m, w);
+            const mat4 mm = m * n, rm = refMul(m, n);
+            diff += !!memcmp(&qq, &rq, sizeof(quat)) + !!memcmp(&qv, &rv, sizeof(vec3)) +
+                    !!memcmp(&mv, &rw, sizeof(vec4)) + !!memcmp(&mm, &rm, sizeof(mat4));
+        }
+        ok &= check(!diff, "quat*quat, quat*vec3, mat4*vec4, mat4*mat4 identical to scalar");
+
+        bool same = true;
+        for(size_t count : { 0, 1, 3, 4, 5, 7, 8, 13, 1000 }) {
+            std::vector<vec3> src(count), dst(count);
+            for(auto &s : src) s = vec3(u(rng), u(rng), u(rng));
+            const quat q = normalize(quat(u(rng), u(rng), u(rng), u(rng)));
+            transform(q, src.data(), .75f, dst.data(), count);
+            for(size_t i = 0; i < count; i++) { const vec3 r = refMul(q, src[i] * .75f); same &= !memcmp(&r, &dst[i], sizeof(vec3)); }
+            transform(q, src.data(), .75f, src.data(), count);    // in place
+            same &= !count || !memcmp(src.data(), dst.data(), count * sizeof(vec3));
+        }
+        ok &= check(same, "transform batch (all counts, in place) identical to scalar");
+    }
+
+    using clk = std::chrono::steady_clock;
+    auto seconds = [](clk::time_point a, clk::time_point b) { return std::chrono::duration<double>(b - a).count(); };
+    struct result { const char *name; double t; double ops; } res[6];
+    volatile float sink = 0.f;   // results used ==> loops not removed
+
+    // dependent chains: latency + throughput of one operation
+    {
+        const mat4 m0(vec4(.8f, .6f, 0, 0), vec4(-.6f, .8f, 0, 0), vec4(0, 0, 1, 0), vec4(.01f, .02f, .03f, 1));   // rotation: no denormals
+        mat4 m(1.f);
+        auto t0 = clk::now();
+        for(int i = 0; i < iterations; i++) m = m * m0;
+        auto t1 = clk::now();
+        res[0] = { "mat4 * mat4", seconds(t0, t1), double(iterations) }; sink += m.m00;
+
+        vec4 v(1.f, .5f, .25f, 1.f);
+        t0 = clk::now();
+        for(int i = 0; i < iterations; i++) v = m0 * v;
+        t1 = clk::now();
+        res[1] = { "mat4 * vec4", seconds(t0, t1), double(iterations) }; sink += v.x;
+
+        const quat s = normalize(quat(.99f, .01f, .02f, .03f));
+        quat q;
+        t0 = clk::now();
+        for(int i = 0; i < iterations; i++) q = q * s;
+        t1 = clk::now();
+        res[2] = { "quat * quat", seconds(t0, t1), double(iterations) }; sink += q.w;
+
+        vec3 p(1.f, 0.f, 0.f);
+        t0 = clk::now();
+        for(int i = 0; i < iterations; i++) p = s * p;
+        t1 = clk::now();
+        res[3] = { "quat * vec3", seconds(t0, t1), double(iterations) }; sink += p.x;
+    }
+
+    // drawFunc sphere: ~ 16 x 32 tessellation, 6 vertices each quad
+    {
+        const size_t count = 16 * 32 * 6;
+        const int frames = std::max(1, iterations / int(count) * 4);
+        std::vector<vec3> src(count), dst(count);
+        for(auto &s : src) s = normalize(vec3(u(rng), u(rng), u(rng)));
+        quat q = normalize(quat(u(rng), u(rng), u(rng), u(rng)));
+        const quat step = normalize(quat(.999f, .01f, .02f, .03f));
+
+        double tBatch = 1e30, tVertex = 1e30;   // best of 5 (warm caches)
+        for(int r = 0; r < 5; r++) {
+            auto t0 = clk::now();
+            for(int f = 0; f < frames; f++) { q = q * step; transform(q, src.data(), .85f, dst.data(), count); sink += dst[f % count].z; }
+            auto t1 = clk::now();
+            for(int f = 0; f < frames; f++) { q = q * step; for(size_t i = 0; i < count; i++) dst[i] = q * (src[i] * .85f); sink += dst[f % count].z; }
+            auto t2 = clk::now();
+            tBatch = std::min(tBatch, seconds(t0, t1)); tVertex = std::min(tVertex, seconds(t1, t2));
+        }
+        res[4] = { "transform batch", tBatch, double(frames) * count };
+        res[5] = { "per vertex", tVertex, double(frames) * count };
+    }
+
+    printf("%s (%d iterations)\n", buildName, iterations);
+    printf("%-16s %8s %10s\n", "", "ns/op", "Mops/s");
+    for(auto &r : res) printf("%-16s %8.2f %10.1f\n", r.name, r.t * 1e9 / r.ops, r.ops / r.t * 1e-6);
+
+    printf("%s\n", ok ? "PASSED" : "FAILED");
+    return ok ? EXIT_SUCCESS : EXIT_FAILURE;
+}
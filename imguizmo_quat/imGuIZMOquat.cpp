@@ -20,8 +20,17 @@ ImVector<vec3> imguiGizmo::cubeVtx;
 ImVector<vec3> imguiGizmo::cubeNorm;
 ImVector<vec3> imguiGizmo::planeVtx;
 ImVector<vec3> imguiGizmo::planeNorm;
+imguiGizmo::frameArena  imguiGizmo::arena;
+imguiGizmo::tessScratch imguiGizmo::scratch;
+imguiGizmo::derivedMesh imguiGizmo::derivedMeshes[imguiGizmo::derivedSlots];
+imguiGizmo::derivedMesh imguiGizmo::derivedTransient[2];
+unsigned imguiGizmo::derivedUseCount = 0;
+unsigned imguiGizmo::derivedBuilds = 0;
 bool imguiGizmo::solidAreBuilt = false;
 bool imguiGizmo::dragActivate = false;
+ImDrawCallback imguiGizmo::drawCallback = nullptr;
+ImVector<imguiGizmo::drawRecord> imguiGizmo::drawRecords;
+int imguiGizmo::drawRecordsFrame = -1;
 //
 //  Settings
 //
@@ -389,15 +398,32 @@ static inline int clamp(int v, int mn, int mx)
 //
 //  LightEffect
 //      faster but minus cute/precise.. ok for sphere
+//      styleAlpha: ImGui::GetStyle().Alpha (read once by batch version)
 ////////////////////////////////////////////////////////////////////////////
-inline ImU32 addLightEffect(ImU32 color, float light)
+inline ImU32 addLightEffectAlpha(ImU32 color, float light, float styleAlpha)
 {         
     float l = ((light<.6f) ? .6f : light) * .8f;  
     float lc = light * 80.0f;                    // ambient component 
     return   clamp(ImU32((( color      & 0xff)*l + lc)),0,255)        |
             (clamp(ImU32((((color>>8)  & 0xff)*l + lc)),0,255) <<  8) |
             (clamp(ImU32((((color>>16) & 0xff)*l + lc)),0,255) << 16) |
-            (ImU32(ImGui::GetStyle().Alpha * (color>>24))  << 24);  
+            (ImU32(styleAlpha * (color>>24))  << 24);  
+}
+
+inline ImU32 addLightEffect(ImU32 color, float light)
+{
+    return addLightEffectAlpha(color, light, ImGui::GetStyle().Alpha);
+}
+//
+//  LightEffect: batch (sphere)
+//      addLightEffect(color, light) for count vertices, light from
+//      rotated z: colors[colorIdx[i]] ==> dst[i]
+////////////////////////////////////////////////////////////////////////////
+static void addLightEffect(const ImU32 *colors, const int *colorIdx, const vec3 *vtx, int count, float drawSize, ImU32 *dst)
+{
+    const float alpha = ImGui::GetStyle().Alpha, halfSize = drawSize*.5f, sqSize = drawSize*drawSize;
+    for(int i = 0; i < count; i++)
+        dst[i] = addLightEffectAlpha(colors[colorIdx[i]], -halfSize + (vtx[i].z*vtx[i].z) / sqSize, alpha);
 }
 //
 //  LightEffect
@@ -424,10 +450,15 @@ inline ImU32 addLightEffect(ImU32 color, float light,  float atten)
 typedef vec3 & (*ptrFunc)(vec3 &);
 
 
+inline float adjustPlaneX(float x, float solidResize)
+{
+    x = (x > 0.0f) ? ( 2.5f * x - 1.6f) : x ;
+    return (x)*.5f+.5f + (x>0 ? -imguiGizmo::planeThickness : imguiGizmo::planeThickness) * solidResize;
+}
+
 inline vec3 &adjustPlane(vec3 &coord)
 {
-    coord.x = (coord.x > 0.0f) ? ( 2.5f * coord.x - 1.6f) : coord.x ;
-    coord.x = (coord.x)*.5f+.5f + (coord.x>0 ? -imguiGizmo::planeThickness : imguiGizmo::planeThickness) * imguiGizmo::solidResizeFactor;
+    coord.x = adjustPlaneX(coord.x, imguiGizmo::solidResizeFactor);
     coord *= vec3(1.0f, 2.0f, 2.0f);
     return coord;
 }
@@ -452,12 +483,209 @@ inline vec3 &adjustSpotCone(vec3 &coord)
     return coord;
 }
 
+//  x of arrow components for axes (already resized): reposition of starting point
+//      part 0 (cone + cylinder from solid at origin), part 1 (full axes: cylinder on negative side)
+inline float axesRemapX(float x, float startingPoint, bool part0, bool showFullAxes)
+{
+    if(!part0 && x >  0)                        x = -startingPoint;
+    if((part0 && x <= 0) ||
+       (!showFullAxes && (x < startingPoint)) ) x =  startingPoint;
+    return x;
+}
+
 inline vec3 fastRotate (int axis, vec3 &v)
 {
     return ((axis == imguiGizmo::axisIsY) ? vec3(-v.y, v.x, v.z) : // rotation Z 90'
            ((axis == imguiGizmo::axisIsZ) ? vec3(-v.z, v.y, v.x) : // rotation Y 90'
                                             v));
 }
+//
+//  Painter's order: stable bucket (counting) sort of primitives on depth,
+//      farthest first (z toward viewer): 1024 buckets on [zMin, zMax] of
+//      current widget, same bucket ==> collection order
+////////////////////////////////////////////////////////////////////////////
+//      CPU path: triangles/quads (solidPrim), GPU path: instances of components (gpuPrim)
+enum { depthBucketsCount = 1024 };
+template <class PRIM>
+static void sortByDepth(const PRIM *prims, int n, int *order, int *buckets)    // buckets: depthBucketsCount + 1
+{
+    const int nBuckets = depthBucketsCount;
+    if(!n) return;
+
+    float zMin = prims[0].depth, zMax = zMin;
+    for(int i = 0; i < n; i++) { zMin = prims[i].depth < zMin ? prims[i].depth : zMin; zMax = prims[i].depth > zMax ? prims[i].depth : zMax; }
+    const float scale = zMax > zMin ? float(nBuckets - 1) / (zMax - zMin) : 0.f;
+    auto key = [&] (int i) { return int((prims[i].depth - zMin) * scale); };
+
+    memset(buckets, 0, sizeof(int) * (nBuckets + 1));
+    for(int i = 0; i < n; i++) buckets[key(i) + 1]++;
+    for(int b = 1; b <= nBuckets; b++) buckets[b] += buckets[b - 1];  // buckets[k]: first position of key k
+    for(int i = 0; i < n; i++) order[buckets[key(i)]++] = i;
+}
+
+//  Scratch of current widget from frame arena, exact budget: the arena buffer
+//      grows only if a widget needs more than all previous ones (warm-up)
+////////////////////////////////////////////////////////////////////////////
+void imguiGizmo::beginScratch(int maxVtx, int maxNorm, int nColors, int maxPrims)
+{
+    arena.reset(frameArena::bytes(int(sizeof(vec3))      * maxVtx)   + frameArena::bytes(int(sizeof(vec3)) * maxNorm) +
+                frameArena::bytes(int(sizeof(ImU32))     * nColors)  +
+                frameArena::bytes(int(sizeof(solidPrim)) * maxPrims) + frameArena::bytes(int(sizeof(int))  * maxPrims) +
+                frameArena::bytes(int(sizeof(int))       * (depthBucketsCount + 1)));
+    scratch.vtxRot  = arena.alloc<vec3>(maxVtx);
+    scratch.normRot = arena.alloc<vec3>(maxNorm);
+    scratch.colRot  = arena.alloc<ImU32>(nColors);
+    scratch.prims   = arena.alloc<solidPrim>(maxPrims);
+    scratch.order   = arena.alloc<int>(maxPrims);
+    scratch.buckets = arena.alloc<int>(depthBucketsCount + 1);
+    scratch.nPrims  = 0;
+}
+
+//  Tessellation core (CPU path)
+//      every primitive is written at end of scratch.prims (capacity: all
+//      primitives of widget) and committed only if visible: culling without branches
+////////////////////////////////////////////////////////////////////////////
+template <int nVtx> static inline void commitPrim(imguiGizmo::solidPrim &p, float depth)
+{   // back faces and degenerate: not committed
+    p.depth = depth; p.nVtx = nVtx;
+    const ImVec2 &a = p.uv[0], &b = p.uv[1], &c = p.uv[nVtx - 1];
+    imguiGizmo::scratch.nPrims += int(cross(vec2(b.x-a.x, b.y-a.y), vec2(c.x-a.x, c.y-a.y)) < 0);
+}
+
+//  prebaked mesh (getDerivedMesh): only rotation (q, normals with qNorm) and lighting
+template <bool isAxes>
+void imguiGizmo::tessDerived(const tessParams &tp, const derivedMesh &m, const quat &q, const quat &qNorm)
+{
+    {
+        VGIZMO_ZONE("imguiGizmo::transform");
+        transform(q    , m.vtx.begin() , 1.f, scratch.vtxRot , m.vtx.size() );
+        transform(qNorm, m.norm.begin(), 1.f, scratch.normRot, m.norm.size());
+    }
+
+    VGIZMO_ZONE("imguiGizmo::lighting");    // + projection and culling
+    solidPrim *prims = scratch.prims;
+    const vec3 *itVtx = scratch.vtxRot, *itNorm = scratch.normRot;
+    for(int part = 0; part < 3; part++) {
+        const vec4 color = isAxes ? vec4(float(part==axisIsX),float(part==axisIsY),float(part==axisIsZ), 1.0) :
+                                    vec4(directionColor.x, directionColor.y, directionColor.z, 1.0);
+        for(const vec3 *partEnd = scratch.vtxRot + m.partEnd[part]; itVtx != partEnd; itVtx += 3) {
+            solidPrim &p = prims[scratch.nPrims];
+#if !defined(imguiGizmo_INTERPOLATE_NORMALS)
+            const vec3 &norm = *itNorm++;
+#endif
+            for(int h=0; h<3; h++) {
+                const vec3 &coord = itVtx[h];
+#ifdef imguiGizmo_INTERPOLATE_NORMALS
+                const vec3 &norm = *itNorm++;
+#endif
+                p.uv[h] = tp.toControl(coord);
+                p.col[h] = addLightEffect(color, norm.z, isAxes ? coord.z : (coord.z>0 ? coord.z : coord.z*.5f));
+            }
+            commitPrim<3>(p, (itVtx[0].z + itVtx[1].z + itVtx[2].z) * (1.f/3.f));
+        }
+    }
+}
+
+//  cube or plane: one normal and one color for quad
+template <bool isCube>
+void imguiGizmo::tessQuads(const tessParams &tp, const ImVector<vec3> &vtx, const ImVector<vec3> &norm)
+{
+    VGIZMO_ZONE("imguiGizmo::quads");       // transform + lighting, one normal for quad
+    solidPrim *prims = scratch.prims;
+    const vec3 *itVtx = vtx.begin();
+    for(const vec3 &n : norm) {
+        solidPrim &p = prims[scratch.nPrims];
+        const vec3 nRot = tp.q * n;
+        vec3 coord;
+        float depth = 0.f;
+        for(int i = 0; i<4; i++) {
+            coord = tp.q * (*itVtx++ * solidResizeFactor);
+            p.uv[i] = tp.toControl(coord);
+            depth += coord.z;
+        }
+        p.col[0] = addLightEffect(isCube ? vec4(abs(n),1.0f) : vec4(planeColor.x, planeColor.y, planeColor.z, planeColor.w), nRot.z, coord.z);
+        commitPrim<4>(p, depth * .25f);
+    }
+}
+
+void imguiGizmo::tessSphere(const tessParams &tp)
+{
+    const int nVtx = sphereVtx.size();
+    // batch: rotate all vertices (wasm_simd128: 4 at time), then lighting from rotated z
+    VGIZMO_ZONE_BEGIN(zoneTransform, "imguiGizmo::transform");
+    transform(tp.q, sphereVtx.begin(), solidResizeFactor, scratch.vtxRot, nVtx);
+    VGIZMO_ZONE_END(zoneTransform);
+    VGIZMO_ZONE_BEGIN(zoneLighting, "imguiGizmo::lighting");
+    addLightEffect(sphereColors, sphereTess.begin(), scratch.vtxRot, nVtx, sphereRadius * solidResizeFactor, scratch.colRot);
+    VGIZMO_ZONE_END(zoneLighting);
+
+    solidPrim *prims = scratch.prims;
+    const vec3 *vtx = scratch.vtxRot;
+    const ImU32 *colors = scratch.colRot;
+    for(int i = 0; i < nVtx; i += 3) {
+        solidPrim &p = prims[scratch.nPrims];
+        for(int h=0; h<3; h++) { p.uv[h] = tp.toControl(vtx[i+h]); p.col[h] = colors[i+h]; }
+        commitPrim<3>(p, (vtx[i].z + vtx[i+1].z + vtx[i+2].z) * (1.f/3.f));
+    }
+}
+
+//  all solids of a widget: tessMode known at compile time
+//      meshes first ==> exact scratch budget, then tessellation
+template <int tessMode>
+void imguiGizmo::tessellate(const tessParams &tp)
+{
+    const bool isDir = (tessMode & (tessDirection | tessDirPlane)) != 0, withPlane = (tessMode & tessDirPlane) != 0;
+    const bool withSphere = !isDir && (tessMode & tessWithSphere), withCube = !isDir && (tessMode & tessWithCube), withSpot = !isDir && (tessMode & tessDual);
+
+    const derivedMesh &arrow = isDir ? getDerivedMesh(withPlane ? derivedDirPlane : derivedDir, vec4(tp.resizeAxes, withPlane ? solidResizeFactor : 0.f)) :
+                                       getDerivedMesh((tessMode & tessFullAxes) ? derivedFullAxes : derivedAxes, vec4(tp.resizeAxes, tp.startingPoint));
+    const derivedMesh *spot = withSpot ? &getDerivedMesh(derivedSpot, vec4(tp.resizeAxes, coneLength)) : nullptr;   // arrow of this frame: not replaced
+
+    const int nSphere = withSphere ? sphereVtx.size() : 0;
+    const int maxVtx  = std::max(std::max(arrow.vtx.size(), spot ? spot->vtx.size() : 0), nSphere);
+    const int maxNorm = std::max(arrow.norm.size(), spot ? spot->norm.size() : 0);
+    const int maxPrims = (arrow.vtx.size() + (spot ? spot->vtx.size() : 0) + nSphere) / 3 +
+                         (withCube ? cubeNorm.size() : 0) + (withPlane ? planeNorm.size() : 0);
+    beginScratch(maxVtx, maxNorm, nSphere, maxPrims);
+
+    tessDerived<!isDir>(tp, arrow, tp.q, tp.q);
+    if(withPlane)  tessQuads<false>(tp, planeVtx, planeNorm);
+    if(withSphere) tessSphere(tp);
+    if(withCube)   tessQuads<true>(tp, cubeVtx, cubeNorm);
+    if(withSpot) {
+#ifdef imguiGizmo_INTERPOLATE_NORMALS
+        tessDerived<false>(tp, *spot, tp.qDual, tp.qDual);
+#else
+        tessDerived<false>(tp, *spot, tp.qDual, tp.q);
+#endif
+    }
+}
+
+//  instantiation for widget mode: direction modes ==> 0, 1
+//      3 axes ==> 2 + origin (none, sphere, cube) * 4 + fullAxes * 2 + dual
+int imguiGizmo::tessModeOf(uint32_t drawMode, uint32_t axesOriginType, bool fullAxes)
+{
+    if(drawMode & modeDirPlane)  return tessDirPlane;
+    if(drawMode & modeDirection) return tessDirection;
+    return ((axesOriginType & sphereAtOrigin) ? tessWithSphere : ((axesOriginType & cubeAtOrigin) ? tessWithCube : 0)) |
+           (fullAxes ? tessFullAxes : 0) | ((drawMode & modeDual) ? tessDual : 0);
+}
+
+imguiGizmo::tessFunc imguiGizmo::tessDispatch(uint32_t drawMode, uint32_t axesOriginType, bool fullAxes)
+{
+#define TESS_AXES(origin) tessellate<origin>, tessellate<origin | tessDual>, tessellate<origin | tessFullAxes>, tessellate<origin | tessFullAxes | tessDual>
+    static const tessFunc tessTable[] = {
+        tessellate<tessDirection>, tessellate<tessDirPlane>,
+        TESS_AXES(0), TESS_AXES(tessWithSphere), TESS_AXES(tessWithCube)
+    };
+#undef TESS_AXES
+    const int tessMode = tessModeOf(drawMode, axesOriginType, fullAxes);
+    if(tessMode & tessDirPlane)  return tessTable[1];
+    if(tessMode & tessDirection) return tessTable[0];
+    const int origin = (tessMode & tessWithSphere) ? 1 : ((tessMode & tessWithCube) ? 2 : 0);
+    return tessTable[2 + origin * 4 + ((tessMode & tessFullAxes) ? 2 : 0) + ((tessMode & tessDual) ? 1 : 0)];
+}
+
 ////////////////////////////////////////////////////////////////////////////
 //
 //  Draw imguiGizmo
@@ -465,6 +693,7 @@ inline vec3 fastRotate (int axis, vec3 &v)
 ////////////////////////////////////////////////////////////////////////////
 bool imguiGizmo::drawFunc(const char* label, float size)
 {
+    VGIZMO_ZONE("imguiGizmo::drawFunc");
 
     ImGuiIO& io = ImGui::GetIO();
     ImGuiStyle& style = ImGui::GetStyle();
@@ -478,18 +707,8 @@ bool imguiGizmo::drawFunc(const char* label, float size)
 
     //  build solids... once!
     ///////////////////////////////////////
-    if (!solidAreBuilt)  {
-        const float arrowBgn = -1.0f, arrowEnd = 1.0f;     
-
-        buildCone    (arrowEnd - coneLength, arrowEnd, coneRadius, coneSlices);
-        buildCylinder(arrowBgn, arrowEnd - coneLength, cylRadius , cylSlices );
-        buildSphere(sphereRadius, sphereTessFactor);
-        buildCube(cubeSize);
-        buildPlane(planeSize);
-        solidAreBuilt = true;
-    }
+    buildSolids();
 
-    ImGui::PushID(label);
     ImGui::BeginGroup();
 
     bool value_changed = false;
@@ -501,8 +720,9 @@ bool imguiGizmo::drawFunc(const char* label, float size)
     const ImVec2 innerSize(squareSize,squareSize);
 
     bool highlighted = false;
-    ImGui::InvisibleButton("imguiGizmo", innerSize);
+    ImGui::InvisibleButton(label, innerSize);   // widget ID from label: one string hash, no ID stack push
 
+    VGIZMO_ZONE_BEGIN(zoneInteraction, "imguiGizmo::interaction");
     bool vgModsActive = false;
     vgModifiers vgMods = vg::evNoModifier;
 
@@ -576,12 +796,11 @@ bool imguiGizmo::drawFunc(const char* label, float size)
         col.Value.w*=ImGui::GetStyle().Alpha;
         draw_list->AddRectFilled(controlPos, controlPos + innerSize, col, style.FrameRounding);
     }
-
+    VGIZMO_ZONE_END(zoneInteraction);
 
     draw_list->PushClipRect(controlPos, controlPos + innerSize, true);
 
     const ImVec2 wpUV = ImGui::GetFontTexUvWhitePixel(); //culling versus
-    ImVec2 uv[4]; ImU32 col[4]; //buffers to storetransformed vtx & col for PrimVtx & PrimQuadUV
 
     quat _q(normalize(qtV));
     //_q = quat(_q.w, isFlipRotY ? -_q.x : _q.x, isFlipRotX ? -_q.y : _q.y, _q.z);
@@ -594,178 +813,31 @@ bool imguiGizmo::drawFunc(const char* label, float size)
 
     auto returnSizeFromRatio = [&] (float ratio) { return squareSize * ratio; };
 
+    //  Solids are not drawn directly: all visible triangles/quads (back faces culled)
+    //  of all components are collected in scratch.prims with their depth (tessellate),
+    //  then sorted (painter's order, per primitive) and emitted in one pass: emitSolids()
     //////////////////////////////////////////////////////////////////
-    auto addTriangle = [&] ()
-    {   // test cull dir        
-        if(cross(vec2(uv[1].x-uv[0].x, uv[1].y-uv[0].y),
-                 vec2(uv[2].x-uv[0].x, uv[2].y-uv[0].y)) > 0) { uv[1] = uv[2] = uv[0]; }
-
-        for(int i=0; i<3; i++) draw_list->PrimVtx(uv[i], wpUV, col[i]);
-    };
-
-    //////////////////////////////////////////////////////////////////
-    auto addQuad = [&] (ImU32 colLight)
-    {   // test cull dir
-        if(cross(vec2(uv[1].x-uv[0].x, uv[1].y-uv[0].y), 
-                 vec2(uv[3].x-uv[0].x, uv[3].y-uv[0].y)) > 0) { uv[3] = uv[1] = uv[2] = uv[0]; }
-
-        draw_list->PrimQuadUV(uv[0],uv[1],uv[2],uv[3], wpUV, wpUV, wpUV, wpUV, colLight); 
-    };
-
-    //////////////////////////////////////////////////////////////////
-    auto drawSphere = [&] () 
-    {
-        draw_list->PrimReserve(sphereVtx.size(), sphereVtx.size()); // num vert/indices 
-        auto itTess = sphereTess.begin();
-        for(auto itVtx = sphereVtx.begin(); itVtx != sphereVtx.end(); )  {
-            for(int h=0; h<3; h++, itTess++) {
-                vec3 coord = _q  * (*itVtx++ * solidResizeFactor);        //Rotate
-
-                uv[h] = normalizeToControlSize(coord.x,coord.y);
-                const float drawSize = sphereRadius * solidResizeFactor;
-                col[h] = addLightEffect(sphereColors[*itTess], (-drawSize*.5f + (coord.z*coord.z) / (drawSize*drawSize))); 
-                //col[h] = colorLightedY(sphereCol[i++], (-sizeSphereRadius.5f + (coord.z*coord.z) / (sizeSphereRadius*sizeSphereRadius)), coord.z); 
-            }
-            addTriangle();
-        }
-    };
-
-    //////////////////////////////////////////////////////////////////
-    auto drawCube = [&] ()  
-    {
-        draw_list->PrimReserve(cubeNorm.size()*6, cubeNorm.size()*4); // num vert/indices 
-        for(vec3* itNorm = cubeNorm.begin(), *itVtx  = cubeVtx.begin() ; itNorm != cubeNorm.end();) {
-            vec3 coord;
-            vec3 norm = _q * *itNorm;
-            for(int i = 0; i<4; ) {
-                coord = _q  * (*itVtx++ * solidResizeFactor);
-                uv[i++] = normalizeToControlSize(coord.x,coord.y);
-            }                    
-            addQuad(addLightEffect(vec4(abs(*itNorm++),1.0f), norm.z, coord.z));
-        }
-    };
-
-    //////////////////////////////////////////////////////////////////
-    auto drawPlane = [&] ()  
+    auto emitSolids = [&] ()
     {
-        draw_list->PrimReserve(planeNorm.size()*6, planeNorm.size()*4); // num vert/indices 
-        for(auto itNorm = planeNorm.begin(), itVtx  = planeVtx.begin() ; itNorm != planeNorm.end();) {
-            vec3 coord;
-            vec3 norm = _q * *itNorm;
-            for(int i = 0; i<4; ) {
-                coord = _q  * (*itVtx++ * solidResizeFactor);
-                uv[i++] = normalizeToControlSize(coord.x,coord.y);
-            }                    
-            itNorm++;
-            addQuad(addLightEffect(vec4(planeColor.x, planeColor.y, planeColor.z, planeColor.w), norm.z, coord.z));
+        const solidPrim *prims = scratch.prims;
+        const int nPrims = scratch.nPrims;
+        VGIZMO_ZONE_BEGIN(zoneSort, "imguiGizmo::depthSort");
+        sortByDepth(prims, nPrims, scratch.order, scratch.buckets);
+        VGIZMO_ZONE_END(zoneSort);
+        VGIZMO_ZONE("imguiGizmo::emission");
+
+        int nVtx = 0, nIdx = 0;
+        for(int i = 0; i < nPrims; i++) { nVtx += prims[i].nVtx; nIdx += prims[i].nVtx == 4 ? 6 : 3; }
+        if(!nVtx) return;
+        draw_list->PrimReserve(nIdx, nVtx); // exact num vert/indices: all solids at once
+
+        for(int k = 0; k < nPrims; k++) {
+            const solidPrim &p = prims[scratch.order[k]];
+            if(p.nVtx == 4) draw_list->PrimQuadUV(p.uv[0],p.uv[1],p.uv[2],p.uv[3], wpUV, wpUV, wpUV, wpUV, p.col[0]);
+            else for(int h=0; h<3; h++) draw_list->PrimVtx(p.uv[h], wpUV, p.col[h]);
         }
     };
 
-    //////////////////////////////////////////////////////////////////
-    auto drawAxes = [&] (int side) 
-    {   
-        for(int n = 0; n < 4; n++) { //Arrow: 2 Cone -> (Surface + cap) + 2 Cyl -> (Surface + cap)
-            for(int arrowAxis = 0; arrowAxis < 3; arrowAxis++) { // draw 3 axes
-                vec3 arrowCoord(0.0f, 0.0f, 0.0f); arrowCoord[arrowAxis] = 1.0f; // rotate on 3 axis (arrow -> X, Y, Z ) in base to current arrowAxis
-                if(arrowAxis == 2) arrowCoord[arrowAxis] = 1.0f;
-                const float arrowCoordZ = vec3(_q*arrowCoord).z; //.Rotate
-
-                const int i = (arrowCoordZ > 0) ? 3 - n : n; //painter algorithm: before farthest
-
-                bool skipCone =true;
-
-                int realSide = axesVecModifier[arrowAxis] > 0 ? side : (side == backSide ? frontSide : backSide);
-                if((realSide == backSide  && arrowCoordZ > 0) || (realSide == frontSide && arrowCoordZ <= 0)) {
-                    if (!showFullAxes && (i == CYL_CAP)) continue; // skip if cylCap is hidden
-                    if (i <= CONE_CAP) continue;  // do not draw cone
-                    else skipCone = false;
-                }
-
-                auto *ptrVtx = arrowVtx+i;
-                draw_list->PrimReserve(ptrVtx->size(), ptrVtx->size()); // // reserve vtx
-
-                for(auto itVtx = ptrVtx->begin(), itNorm = (arrowNorm+i)->begin(); itVtx != ptrVtx->end(); ) { //for all Vtx
-#if !defined(imguiGizmo_INTERPOLATE_NORMALS)
-                    vec3 norm( _q * fastRotate(arrowAxis, *itNorm++));
-#endif
-                    for(int h=0; h<3; h++) {
-                        vec3 coord(*itVtx++ * resizeAxes); //  reduction
-                    // reposition starting point...
-                        if(!skipCone && coord.x >  0)                          coord.x = -arrowStartingPoint; 
-                        if((skipCone && coord.x <= 0) || 
-                           (!showFullAxes && (coord.x < arrowStartingPoint)) ) coord.x =  arrowStartingPoint;
-                    //transform
-                        coord = _q * fastRotate(arrowAxis, coord);
-                        uv[h] = normalizeToControlSize(coord.x,coord.y);
-#ifdef imguiGizmo_INTERPOLATE_NORMALS
-                        vec3 norm( _q * fastRotate(arrowAxis, *itNorm++));
-#endif
-                        col[h] = addLightEffect(vec4(float(arrowAxis==axisIsX),float(arrowAxis==axisIsY),float(arrowAxis==axisIsZ), 1.0), norm.z, coord.z);
-                    }
-                    addTriangle();
-                }
-            }
-        }
-    };
-
-    //////////////////////////////////////////////////////////////////
-    auto drawComponent = [&] (const int idx, const quat &q, ptrFunc func)
-    {
-        auto *ptrVtx = arrowVtx+idx;
-        draw_list->PrimReserve(ptrVtx->size(), ptrVtx->size()); // reserve vtx
-        for(auto itVtx = ptrVtx->begin(), itNorm = (arrowNorm+idx)->begin(); itVtx != ptrVtx->end(); ) { 
-#if !defined(imguiGizmo_INTERPOLATE_NORMALS)
-            vec3 norm = _q * *itNorm++;
-#endif
-            for(int h=0; h<3; h++) {
-                vec3 coord = *itVtx++;
-#ifdef imguiGizmo_INTERPOLATE_NORMALS
-                vec3 norm = q * *itNorm++;
-#endif
-                coord = q * (func(coord) * resizeAxes); // remodelling Directional Arrow (func) and transforms;
-
-                uv[h] = normalizeToControlSize(coord.x,coord.y);
-                col[h] = addLightEffect(vec4(directionColor.x, directionColor.y, directionColor.z, 1.0), norm.z, coord.z>0 ? coord.z : coord.z*.5);
-            }
-            addTriangle();
-        }
-    };
-
-    //////////////////////////////////////////////////////////////////
-    auto dirArrow = [&] (const quat &qt, int mode)
-    {
-        quat q (qt.w, qt.x, qt.y, qt.z);
-        vec3 arrowCoord(_q * vec3(1.0f, 0.0f, 0.0f));
-
-        ptrFunc func = (mode & modeDirPlane) ? adjustPlane : adjustDir;
-
-        if(arrowCoord.z <= 0) { for(int i = 0; i <  4; i++) drawComponent(i, q, func); if(mode & modeDirPlane) drawPlane(); }
-        else                  { if(mode & modeDirPlane) drawPlane(); for(int i = 3; i >= 0; i--) drawComponent(i, q, func); }
-    };
-    
-    //////////////////////////////////////////////////////////////////
-    auto spotArrow = [&] (const quat &qt, const float arrowCoordZ)
-    {
-        quat q (qt.w, qt.x, qt.y, qt.z);
- //flipRotation(qt);
-        if(arrowCoordZ > 0) { 
-            drawComponent(CONE_SURF, q, adjustSpotCone); drawComponent(CONE_CAP , q, adjustSpotCone);
-            drawComponent(CYL_SURF , q, adjustSpotCyl ); drawComponent(CYL_CAP  , q, adjustSpotCyl );
-        } else {
-            drawComponent(CYL_CAP  , q, adjustSpotCyl ); drawComponent(CYL_SURF , q, adjustSpotCyl );
-            drawComponent(CONE_CAP , q, adjustSpotCone); drawComponent(CONE_SURF, q, adjustSpotCone);
-        }
-    };
-
-    //////////////////////////////////////////////////////////////////
-    auto draw3DSystem = [&] ()
-    {
-        drawAxes(backSide);
-        if     (axesOriginType & sphereAtOrigin) drawSphere();
-        else if(axesOriginType & cubeAtOrigin)   drawCube();
-        drawAxes(frontSide);  
-    };
-
 #define CENTER_HELPER_X -.85f
 #define CENTER_HELPER_Y -.85f
     //////////////////////////////////////////////////////////////////
@@ -846,19 +918,35 @@ bool imguiGizmo::drawFunc(const char* label, float size)
     ///////////////////////////////////////
     //if((drawMode & modePanDolly) && (ImGui::IsItemHovered() || ImGui::IsMouseDragging(0))) {
 
-    if(drawMode & (modeDirection | modeDirPlane)) dirArrow(_q, drawMode);
-    else { // draw arrows & solid
-        if(drawMode & modeDual) {
-#ifdef IMGUIZMO_HAS_NEGATIVE_VEC3_LIGHT
-            vec3 spot(qtV2 * vec3(-1.0f, 0.0f, .0f));
-            if(spot.z>0) // versus opposite
-#else
-            vec3 spot { qtV2 * vec3( 1.0f, 0.0f, .0f) };
-            if(spot.z<0)
-#endif
-                         { draw3DSystem(); spotArrow(normalize(qtV2),spot.z); }
-            else         { spotArrow(normalize(qtV2),spot.z); draw3DSystem(); }
-        } else draw3DSystem();
+    if(drawCallback) { // GPU: record + callback, solids are drawn from backend
+        const int frame = ImGui::GetFrameCount();
+        if(drawRecordsFrame != frame) { drawRecords.resize(0); drawRecordsFrame = frame; }
+
+        drawRecord rec;
+        rec.pos = controlPos; rec.size = squareSize;
+        rec.flags = uint32_t(drawMode | axesOriginType | (showFullAxes ? modeFullAxes : 0));
+        rec.qtV = qtV; rec.qtV2 = qtV2;
+        rec.resizeAxes = resizeAxes; rec.solidResize = solidResizeFactor;
+        rec.sphereColors[0] = sphereColors[0]; rec.sphereColors[1] = sphereColors[1];
+        rec.directionColor = ImGui::ColorConvertFloat4ToU32(directionColor);
+        rec.planeColor     = ImGui::ColorConvertFloat4ToU32(planeColor);
+        rec.alpha = style.Alpha;
+        drawRecords.push_back(rec);
+
+        draw_list->AddCallback(drawCallback, (void *) intptr_t(drawRecords.size() - 1));
+        draw_list->AddCallback(ImDrawCallback_ResetRenderState, nullptr);
+    }
+    else { // collect all solids (tessellation specialized for mode), then emit them sorted by depth
+        tessParams tp;
+        tp.pos = controlPos; tp.halfSize = halfSquareSize;
+        tp.q = _q; tp.qDual = normalize(qtV2);
+        tp.resizeAxes = resizeAxes; tp.startingPoint = arrowStartingPoint;
+
+        {
+            VGIZMO_ZONE("imguiGizmo::tessellate");
+            tessDispatch(drawMode, axesOriginType, showFullAxes)(tp);
+        }
+        emitSolids();
     }
 
     // Helper on vgModifier active
@@ -882,11 +970,247 @@ bool imguiGizmo::drawFunc(const char* label, float size)
     draw_list->PopClipRect();
 
     ImGui::EndGroup();
-    ImGui::PopID();
 
     return value_changed;
 }
 
+//  Solids (CPU lists of triangles/quads): built once, with the first widget
+////////////////////////////////////////////////////////////////////////////
+void imguiGizmo::buildSolids()
+{
+    if (solidAreBuilt) return;
+    VGIZMO_ZONE("imguiGizmo::buildSolids");
+    const float arrowBgn = -1.0f, arrowEnd = 1.0f;     
+
+    buildCone    (arrowEnd - coneLength, arrowEnd, coneRadius, coneSlices);
+    buildCylinder(arrowBgn, arrowEnd - coneLength, cylRadius , cylSlices );
+    buildSphere(sphereRadius, sphereTessFactor);
+    buildCube(cubeSize);
+    buildPlane(planeSize);
+    solidAreBuilt = true;
+}
+
+//  Derived meshes (drawFunc CPU path): arrow components with all per vertex
+//      remodelling already applied, built with current settings (key)
+////////////////////////////////////////////////////////////////////////////
+const imguiGizmo::derivedMesh &imguiGizmo::getDerivedMesh(int kind, const vec4 &key)
+{
+    const int frame = ImGui::GetFrameCount();
+    derivedMesh *lru = nullptr;     // least recently used of previous frames
+    for(derivedMesh &m : derivedMeshes) {
+        if(m.kind == kind && m.key.x == key.x && m.key.y == key.y && m.key.z == key.z && m.key.w == key.w) { m.lastUse = ++derivedUseCount; m.lastFrame = frame; return m; }
+        if(m.lastFrame != frame && (!lru || m.lastUse < lru->lastUse)) lru = &m;
+    }
+
+    VGIZMO_ZONE("imguiGizmo::derivedMesh");
+    // not found: (re)build in least recently used slot (vectors keep their capacity),
+    //      all slots used in this frame ==> transient slot (alternate: arrow and spot of same widget)
+    static int transient = 0;
+    derivedMesh &m = lru ? *lru : derivedTransient[transient ^= 1];
+    m.kind = kind; m.key = key; m.lastUse = ++derivedUseCount; m.lastFrame = frame;
+    derivedBuilds++;
+    m.vtx.resize(0); m.norm.resize(0);
+    const vec3 resizeAxes(key.x, key.y, key.z);
+
+    if(kind == derivedAxes || kind == derivedFullAxes) {
+        const bool showFullAxes = kind == derivedFullAxes;
+        const float arrowStartingPoint = key.w;
+        for(int arrowAxis = 0; arrowAxis < 3; arrowAxis++) {
+            // part 0: cone + cylinder from solid at origin to cone, part 1 (full axes only): cylinder on negative side
+            for(int part = 0; part < (showFullAxes ? 2 : 1); part++) {
+                const bool skipCone = (part == 0);
+                for(int i = skipCone ? CONE_SURF : CYL_SURF; i <= CYL_CAP; i++) {
+                    for(vec3 &n : arrowNorm[i]) m.norm.push_back(fastRotate(arrowAxis, n));
+                    for(vec3 &v : arrowVtx[i]) {
+                        vec3 coord(v * resizeAxes); //  reduction
+                        coord.x = axesRemapX(coord.x, arrowStartingPoint, skipCone, showFullAxes);
+                        m.vtx.push_back(fastRotate(arrowAxis, coord));
+                    }
+                }
+            }
+            m.partEnd[arrowAxis] = m.vtx.size();
+        }
+    } else {    // direction, plane-direction, spot: key.w (solidResizeFactor, coneLength) is the current global value
+        for(int i = CONE_SURF; i <= CYL_CAP; i++) {
+            const ptrFunc func = (kind == derivedDir) ? adjustDir : ((kind == derivedDirPlane) ? adjustPlane :
+                                                                     ((i <= CONE_CAP) ? adjustSpotCone : adjustSpotCyl));
+            for(vec3 &n : arrowNorm[i]) m.norm.push_back(n);
+            for(vec3 coord : arrowVtx[i]) m.vtx.push_back(func(coord) * resizeAxes); // remodelling arrow (func)
+        }
+        m.partEnd[0] = m.partEnd[1] = m.partEnd[2] = m.vtx.size();
+    }
+    return m;
+}
+
+//  GPU meshes: the same solids as triangle lists with normals
+//      arrow components are in [-1, 1] on X, sphere/cube/plane are not resized
+////////////////////////////////////////////////////////////////////////////
+void imguiGizmo::buildMeshes(ImVector<gpuVertex> &vtx, meshRange ranges[meshCount])
+{
+    buildSolids();
+    vtx.resize(0);
+
+    auto addVtx = [&] (const vec3 &p, const vec3 &n, float tess) {
+        const gpuVertex v = { { float(p.x), float(p.y), float(p.z) }, { float(n.x), float(n.y), float(n.z) }, tess };
+        vtx.push_back(v);
+    };
+    auto beginMesh = [&] (int mesh) { ranges[mesh].firstVertex = vtx.size(); };
+    auto endMesh   = [&] (int mesh) { ranges[mesh].vertexCount = vtx.size() - ranges[mesh].firstVertex; };
+
+    for(int i = 0; i < 4; i++) { // Arrow: Cone -> (Surface + cap), Cyl -> (Surface + cap)
+        beginMesh(i);
+        const vec3 *itNorm = arrowNorm[i].begin();
+        for(const vec3 *itVtx = arrowVtx[i].begin(); itVtx != arrowVtx[i].end(); ) {
+#if !defined(imguiGizmo_INTERPOLATE_NORMALS)
+            const vec3 &norm = *itNorm++;
+            for(int h=0; h<3; h++) addVtx(*itVtx++, norm, 0.f);
+#else
+            for(int h=0; h<3; h++) addVtx(*itVtx++, *itNorm++, 0.f);
+#endif
+        }
+        endMesh(i);
+    }
+
+    beginMesh(meshSphere);
+    for(int i = 0; i < sphereVtx.size(); i++) addVtx(sphereVtx[i], sphereVtx[i] / sphereRadius, float(sphereTess[i]));
+    endMesh(meshSphere);
+
+    // quads ==> 2 triangles, same split of PrimQuadUV
+    auto addQuads = [&] (int mesh, const ImVector<vec3> &quadVtx, const ImVector<vec3> &quadNorm) {
+        static const int split[6] = { 0, 1, 2, 0, 2, 3 };
+        beginMesh(mesh);
+        for(int i = 0; i < quadNorm.size(); i++)
+            for(int h = 0; h < 6; h++) addVtx(quadVtx[i*4 + split[h]], quadNorm[i], 0.f);
+        endMesh(mesh);
+    };
+    addQuads(meshCube , cubeVtx , cubeNorm );
+    addQuads(meshPlane, planeVtx, planeNorm);
+}
+
+//  GPU instances of a widget: same pipeline of CPU path (tessellate ==> sortByDepth)
+//      the components of tessMode (axes/direction arrows as derived meshes, plane,
+//      sphere, cube, spot arrow) are collected with their depth (z of rotated
+//      center), sorted in painter's order and emitted: same mesh ==> one batch
+//
+//      vertices of arrow components have only 2 values of x (cone: base/tip,
+//      cylinder: begin/end) or 1 (caps): the x remapping of CPU path (axesRemapX,
+//      adjustDir, adjustPlane, adjustSpot...) evaluated on these values is
+//      exactly an affine map x*a + b for the instance
+////////////////////////////////////////////////////////////////////////////
+struct gpuPrim { imguiGizmo::gpuInstance inst; int mesh; float depth; };
+
+void imguiGizmo::buildInstances(const drawRecord &rec, ImVector<gpuInstance> &inst, ImVector<gpuBatch> &batches)
+{
+    buildSolids();
+    inst.resize(0);
+    batches.resize(0);
+
+    const int tessMode = tessModeOf(rec.flags & modeMask, rec.flags & axesModeMask, (rec.flags & modeFullAxes) != 0);
+    const bool isDir = (tessMode & (tessDirection | tessDirPlane)) != 0, withPlane = (tessMode & tessDirPlane) != 0;
+    const bool withSphere = (tessMode & tessWithSphere) != 0, withCube = (tessMode & tessWithCube) != 0, withSpot = (tessMode & tessDual) != 0;
+    const bool showFullAxes = (tessMode & tessFullAxes) != 0;
+    const vec3 &resizeAxes = rec.resizeAxes;
+    const float solidResize = rec.solidResize;
+    const float halfSquareSize = rec.size * .5f;
+
+    const float arrowStartingPoint = withSphere ? sphereRadius * solidResize :
+                                    (withCube   ? cubeSize     * solidResize :
+                                                  cylRadius * .5);
+    const float xCone = 1.0f - coneLength;  // arrowEnd - coneLength (buildSolids)
+    const float meshX[4][2] = { { xCone, 1.0f }, { xCone, xCone }, { -1.0f, xCone }, { -1.0f, -1.0f } };
+
+    auto colorOf = [&] (ImU32 c) { ImVec4 v = ImGui::ColorConvertU32ToFloat4(c); v.w *= rec.alpha; return v; };
+    const ImVec4 dirColor(colorOf(rec.directionColor).x, colorOf(rec.directionColor).y, colorOf(rec.directionColor).z, rec.alpha); // CPU: alpha 1.0
+    const ImVec4 plnColor(colorOf(rec.planeColor));
+
+    const quat _q(normalize(rec.qtV)), qDual(normalize(rec.qtV2));
+
+    // scratch from frame arena (exact budget, like beginScratch): components and depth sort
+    const int maxPrims = isDir ? 4 + int(withPlane) : 3 * (showFullAxes ? 6 : 4) + int(withSphere || withCube) + (withSpot ? 4 : 0);
+    arena.reset(frameArena::bytes(int(sizeof(gpuPrim)) * maxPrims) + frameArena::bytes(int(sizeof(int)) * maxPrims) +
+                frameArena::bytes(int(sizeof(int)) * (depthBucketsCount + 1)));
+    gpuPrim *prims = arena.alloc<gpuPrim>(maxPrims);
+    int *order = arena.alloc<int>(maxPrims), *buckets = arena.alloc<int>(depthBucketsCount + 1);
+    int nPrims = 0;
+
+    //////////////////////////////////////////////////////////////////
+    auto addInstance = [&] (int mesh, const quat &q, const quat &nq, int axis, float a, float b, float sy, float sz,
+                            const ImVec4 &color, const ImVec4 &color2, int light, float lightParam, float depth)
+    {
+        const gpuInstance i = { { float(q.x), float(q.y), float(q.z), float(q.w) }, { float(nq.x), float(nq.y), float(nq.z), float(nq.w) },
+                                { a, b, sy, sz },
+                                { rec.pos.x + halfSquareSize, rec.pos.y + halfSquareSize, halfSquareSize, float(axis) },
+                                { color.x, color.y, color.z, color.w }, { color2.x, color2.y, color2.z, color2.w },
+                                { float(light), lightParam, 0.f, 0.f } };
+        gpuPrim &p = prims[nPrims++];
+        p.inst = i; p.mesh = mesh; p.depth = depth;
+    };
+
+    // f0, f1: remapped x of the 2 mesh x values
+    auto addArrowComponent = [&] (int mesh, const quat &q, const quat &nq, int axis, float f0, float f1, float sy, float sz, const ImVec4 &color, int light)
+    {
+        const float x0 = meshX[mesh][0], x1 = meshX[mesh][1];
+        const float a = (x1 != x0) ? (f1 - f0) / (x1 - x0) : 0.f;
+        vec3 center((f0 + f1) * .5f, 0.f, 0.f);
+        addInstance(mesh, q, nq, axis, a, f0 - a * x0, sy, sz, color, color, light, 0.f, vec3(q * fastRotate(axis, center)).z);
+    };
+
+    //////////////////////////////////////////////////////////////////
+    auto addAxes = [&] ()   // getDerivedMesh(derivedAxes / derivedFullAxes)
+    {
+        for(int arrowAxis = 0; arrowAxis < 3; arrowAxis++) {
+            const ImVec4 color(float(arrowAxis==axisIsX), float(arrowAxis==axisIsY), float(arrowAxis==axisIsZ), rec.alpha);
+            for(int part = 0; part < (showFullAxes ? 2 : 1); part++) {
+                auto remapX = [&] (float x) { return axesRemapX(x * resizeAxes.x, arrowStartingPoint, part == 0, showFullAxes); };
+                for(int i = (part == 0) ? CONE_SURF : CYL_SURF; i <= CYL_CAP; i++)
+                    addArrowComponent(i, _q, _q, arrowAxis, remapX(meshX[i][0]), remapX(meshX[i][1]), resizeAxes.y, resizeAxes.z, color, lightAxes);
+            }
+        }
+    };
+
+    //////////////////////////////////////////////////////////////////
+    auto addComponent = [&] (const int idx, const quat &q, ptrFunc func) // getDerivedMesh(derivedDir / derivedDirPlane / derivedSpot)
+    {
+        auto remapX = [&] (float x) {
+            vec3 coord(x, 0.f, 0.f);
+            if(func == adjustPlane) coord.x = adjustPlaneX(x, solidResize);
+            else                    func(coord);
+            return coord.x * resizeAxes.x;
+        };
+        const float yzScale = (func == adjustDir) ? 3.0f : ((func == adjustPlane) ? 2.0f : 1.0f);
+#if !defined(imguiGizmo_INTERPOLATE_NORMALS)
+        const quat &nq = _q;
+#else
+        const quat &nq = q;
+#endif
+        addArrowComponent(idx, q, nq, axisIsX, remapX(meshX[idx][0]), remapX(meshX[idx][1]), yzScale * resizeAxes.y, yzScale * resizeAxes.z, dirColor, lightArrow);
+    };
+
+    // solids at origin: depth 0
+    auto addSolid = [&] (int mesh, const ImVec4 &color, const ImVec4 &color2, int light, float lightParam) {
+        addInstance(mesh, _q, _q, axisIsX, solidResize, 0.f, solidResize, solidResize, color, color2, light, lightParam, 0.f);
+    };
+
+    //  collect: same components of tessellate<tessMode>
+    //////////////////////////////////////////////////////////////////
+    if(isDir) for(int i = CONE_SURF; i <= CYL_CAP; i++) addComponent(i, _q, withPlane ? adjustPlane : adjustDir);
+    else      addAxes();
+    if(withPlane)  addSolid(meshPlane, plnColor, plnColor, lightAxes, 0.f);
+    if(withSphere) addSolid(meshSphere, colorOf(rec.sphereColors[0]), colorOf(rec.sphereColors[1]), lightSphere, sphereRadius * solidResize);
+    if(withCube)   addSolid(meshCube, ImVec4(0.f, 0.f, 0.f, rec.alpha), ImVec4(0.f, 0.f, 0.f, rec.alpha), lightCube, 0.f); // color from normal
+    if(withSpot)   for(int i = CONE_SURF; i <= CYL_CAP; i++) addComponent(i, qDual, (i <= CONE_CAP) ? adjustSpotCone : adjustSpotCyl);
+
+    //  sort (painter's order) and emit: consecutive instances of same mesh ==> one batch
+    //////////////////////////////////////////////////////////////////
+    sortByDepth(prims, nPrims, order, buckets);
+    for(int k = 0; k < nPrims; k++) {
+        const gpuPrim &p = prims[order[k]];
+        if(batches.size() && batches.back().mesh == p.mesh) batches.back().instanceCount++;
+        else { const gpuBatch batch = { p.mesh, inst.size(), 1 }; batches.push_back(batch); }
+        inst.push_back(p.inst);
+    }
+}
+
 //  Polygon
 ////////////////////////////////////////////////////////////////////////////
 void imguiGizmo::buildPolygon(const vec3 &size, ImVector<vec3> &vtx, ImVector<vec3> &norm)
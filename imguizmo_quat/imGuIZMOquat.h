@@ -118,6 +118,67 @@ struct imguiGizmo
     static ImVector<vec3> planeNorm;
     static ImVector<vec3> arrowVtx[4];
     static ImVector<vec3> arrowNorm[4];
+    // drawFunc scratch: one arena buffer (reused, grows only during warm-up), carved for each widget
+    // from its exact budget: batch transform/lighting, visible primitives and their depth sort
+    struct solidPrim { ImVec2 uv[4]; ImU32 col[4]; float depth; int nVtx; }; // triangle: nVtx 3, col per vertex - quad: nVtx 4, col[0]
+    struct frameArena {
+        ImVector<char> buffer;
+        int used = 0;
+        static int bytes(int size) { return (size + 15) & ~15; }     // 16 bytes aligned blocks
+        void reset(int size) { used = 0; if(buffer.size() < size) buffer.resize(size); }
+        template <class T> T *alloc(int count) {
+            T *p = (T *) (buffer.Data + used); used += bytes(int(sizeof(T)) * count);
+            IM_ASSERT(used <= buffer.size() && "frameArena: allocation out of budget");
+            return p;
+        }
+    };
+    struct tessScratch {
+        vec3 *vtxRot, *normRot;         // rotated vertices/normals of current mesh (largest mesh of widget)
+        ImU32 *colRot;                  // sphere: lighted colors
+        solidPrim *prims; int nPrims;   // visible primitives (capacity: all primitives of widget)
+        int *order, *buckets;           // depth sort (sortByDepth)
+    };
+    static frameArena arena;
+    static tessScratch scratch;
+    static void beginScratch(int maxVtx, int maxNorm, int nColors, int maxPrims);
+    // Derived meshes: arrow components remodelled for axes (per axis rotation, resize, starting
+    // point), direction, plane-direction and spot arrows (adjustDir/Plane/Spot): pure functions of
+    // settings ==> built on first use and rebuilt only when key settings change
+    //      cache: up to derivedSlots different keys in a frame, least recently used slot of a previous
+    //      frame is replaced (settings change); more keys in a frame: the excess is built in a transient
+    //      slot (not cached) ==> meshes of current frame are never evicted by other widgets
+    enum { derivedAxes, derivedFullAxes, derivedDir, derivedDirPlane, derivedSpot };
+    struct derivedMesh {
+        int kind = -1;
+        vec4 key;                       // resizeAxes + axes starting point / solidResizeFactor / coneLength
+        ImVector<vec3> vtx, norm;       // norm: per triangle (per vertex with imguiGizmo_INTERPOLATE_NORMALS)
+        int partEnd[3];                 // axes: vtx end of X, Y, Z arrow (color), others: all vtx
+        unsigned lastUse = 0;           // least recently used slot is rebuilt
+        int lastFrame = -1;             // ImGui frame of last use
+    };
+    enum { derivedSlots = 16 };
+    static derivedMesh derivedMeshes[derivedSlots];
+    static derivedMesh derivedTransient[2];     // arrow + spot of a widget
+    static unsigned derivedUseCount;
+    static unsigned derivedBuilds;              // meshes built (first use, settings change, transient): for tests
+    static const derivedMesh &getDerivedMesh(int kind, const vec4 &key);
+    // CPU tessellation core: visible primitives of widget solids ==> scratch.prims, specialized on
+    // mode bits (tessMode) ==> no mode tests inside vertex loops, instantiation from tessDispatch()
+    enum { tessDirection = 0x01, tessDirPlane = 0x02, tessWithSphere = 0x04, tessWithCube = 0x08, tessFullAxes = 0x10, tessDual = 0x20 };
+    struct tessParams {
+        ImVec2 pos; float halfSize;         // control position and half size (normalizeToControlSize)
+        quat q, qDual;                      // normalized rotations: widget, spot arrow (modeDual)
+        vec3 resizeAxes;                    // already reduced for modeDual
+        float startingPoint;                // axes starting point (solid at origin)
+        ImVec2 toControl(const vec3 &v) const { return pos + ImVec2(v.x,-v.y) * halfSize + ImVec2(halfSize,halfSize); }
+    };
+    typedef void (*tessFunc)(const tessParams &);
+    static int tessModeOf(uint32_t drawMode, uint32_t axesOriginType, bool fullAxes);     // also GPU path (buildInstances)
+    static tessFunc tessDispatch(uint32_t drawMode, uint32_t axesOriginType, bool fullAxes);
+    template <int tessMode> static void tessellate(const tessParams &tp);
+    template <bool isAxes>  static void tessDerived(const tessParams &tp, const derivedMesh &m, const quat &q, const quat &qNorm);
+    template <bool isCube>  static void tessQuads(const tessParams &tp, const ImVector<vec3> &vtx, const ImVector<vec3> &norm);
+    static void tessSphere(const tessParams &tp);
     static void buildPlane   (const float size, const float thickness = planeThickness) {
         buildPolygon(vec3(thickness,size,size), planeVtx, planeNorm);
     }
@@ -128,6 +189,7 @@ struct imguiGizmo
     static void buildSphere  (float radius, int tessFactor);
     static void buildCone    (float x0, float x1, float radius, int slices);
     static void buildCylinder(float x0, float x1, float radius, int slices);
+    static void buildSolids();
     
     //-------------------------------------
     // helper functions
@@ -273,6 +335,61 @@ struct imguiGizmo
 
     bool drawFunc(const char* label, float size);
 
+    //  GPU rendering: compact draw commands instead of CPU tessellated triangles
+    //--------------------------------------------------------------------------
+    //  With a draw callback set, drawFunc does not transform/light the solids on
+    //  CPU: it adds to ImDrawList only background, helpers and label, plus a
+    //  drawRecord (widget rect, quaternions, mode, colors, resize factors) and
+    //  an ImDrawCallback followed by ImDrawCallback_ResetRenderState.
+    //  Inside the callback (during backend RenderDrawData):
+    //      getDrawRecord(cmd) ==> buildInstances() ==> instanced draw of the
+    //      meshes from buildMeshes(), lighting per fragment (same formulas of
+    //      addLightEffect)
+    //  Reference implementation: commons/utils/imguizmoGpuCPU.h (CPU rasterizer,
+    //  no GPU: vertex/fragment stages to port to the shaders of a backend)
+    //
+    //      imguiGizmo::setDrawCallback(myBackendDrawCallback); // nullptr ==> CPU triangles (default)
+    //--------------------------------------------------------------------------
+    enum { meshConeSurf = CONE_SURF, meshConeCap = CONE_CAP, meshCylSurf = CYL_SURF, meshCylCap = CYL_CAP,
+           meshSphere, meshCube, meshPlane, meshCount };
+    enum { lightAxes, lightCube, lightArrow, lightSphere };     // gpuInstance::light[0]
+
+    struct drawRecord {
+        ImVec2 pos;             // widget top-left corner (screen coordinates)
+        float size;             // widget side (pixels)
+        uint32_t flags;         // drawMode | axesOriginType | modeFullAxes
+        quat qtV, qtV2;         // axes/direction rotation, spot rotation (modeDual)
+        vec3 resizeAxes;        // axes resize (already reduced for modeDual)
+        float solidResize;
+        ImU32 sphereColors[2], directionColor, planeColor;
+        float alpha;            // style alpha
+    };
+    struct gpuVertex   { float pos[3], norm[3], tess; };    // tess: sphere tessellation color (0/1)
+    struct gpuInstance {
+        float rot[4];           // quaternion (x, y, z, w)
+        float normRot[4];       // quaternion of normals (spot arrow: lighted as main rotation, like CPU path)
+        float xform[4];         // mesh vertex remap: (x*a + b, y*sy, z*sz) ==> (a, b, sy, sz)
+        float screen[4];        // widget center (x, y), half size (pixels), axis (0: X, 1: Y, 2: Z ==> fastRotate)
+        float color[4];         // base color, alpha * style alpha
+        float color2[4];        // lightSphere: 2nd tessellation color
+        float light[4];         // light type, lightSphere: sphere radius
+    };
+    struct gpuBatch   { int mesh, firstInstance, instanceCount; };  // consecutive instances of same mesh
+    struct meshRange  { int firstVertex, vertexCount; };            // triangle list
+
+    static void setDrawCallback(ImDrawCallback cb) { drawCallback = cb; }
+    static ImDrawCallback getDrawCallback() { return drawCallback; }
+    // valid until next frame (records are collected for all widgets of current frame)
+    static const drawRecord &getDrawRecord(const ImDrawCmd *cmd) { return drawRecords[int(intptr_t(cmd->UserCallbackData))]; }
+
+    static void buildMeshes(ImVector<gpuVertex> &vtx, meshRange ranges[meshCount]);
+    // instances in draw order: components of CPU path sorted by depth (painter's order), back faces must be culled
+    static void buildInstances(const drawRecord &rec, ImVector<gpuInstance> &inst, ImVector<gpuBatch> &batches);
+
+    static ImDrawCallback drawCallback;
+    static ImVector<drawRecord> drawRecords;
+    static int drawRecordsFrame;
+
     void modeSettings(uint32_t mode) {
         drawMode = uint32_t(mode & modeMask); axesOriginType = uint32_t(mode & axesModeMask); showFullAxes = bool(modeFullAxes & mode); }
 
@@ -23,8 +23,17 @@
 
     #include <cmath>
     #include <cstdint>
+    #include <cstddef>
+    #include <cstring>
     #include <assert.h>
     #include <limits>
+    #if defined(__SSE__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 1)
+        #include <xmmintrin.h>
+    #endif
+    #if defined(__wasm_simd128__) && !defined(VGM_DISABLE_SIMD)
+        #include <wasm_simd128.h>
+        #define VGM_USES_WASM_SIMD
+    #endif
 
     #define VGM_NAMESPACE vgm
 
@@ -80,6 +89,62 @@ TEMPLATE_TYPENAME_T class Mat4;
     #define T VG_T_TYPE
 #endif
 
+// wasm_simd128 kernels (emscripten -msimd128), float only: other types use scalar code
+//  mat4 * mat4, mat4 * vec4 and batch transform (quat * vec3 on arrays, 4 at time):
+//  single quat * quat / quat * vec3 stay scalar (shuffles cost more than they save)
+//  same operations in same order of scalar code (wasm has no FMA contraction)
+//  ==> results identical, bit by bit, to scalar wasm and native builds
+//  -DVGM_DISABLE_SIMD ==> scalar code also with -msimd128
+//////////////////////////
+#ifdef VGM_USES_WASM_SIMD
+namespace simd128 {
+template<typename U> inline bool mulMat4(const U *, const U *, U *) { return false; }
+template<typename U> inline bool mulMat4Vec4(const U *, const U *, U *) { return false; }
+template<typename U> inline size_t transform(const U *, const U *, U, U *, size_t) { return 0; }
+
+#define VGM_SHUF(A, B, X, Y, Z, W) wasm_i32x4_shuffle(A, B, X, Y, Z, W)
+inline v128_t mulCol(const v128_t *c, const float *v) {    // ((c0*v.x + c1*v.y) + c2*v.z) + c3*v.w
+    return wasm_f32x4_add(wasm_f32x4_add(wasm_f32x4_add(wasm_f32x4_mul(c[0], wasm_f32x4_splat(v[0])), wasm_f32x4_mul(c[1], wasm_f32x4_splat(v[1]))),
+                                                        wasm_f32x4_mul(c[2], wasm_f32x4_splat(v[2]))), wasm_f32x4_mul(c[3], wasm_f32x4_splat(v[3]))); }
+
+inline bool mulMat4(const float *a, const float *b, float *r) {
+    const v128_t c[4] = { wasm_v128_load(a), wasm_v128_load(a + 4), wasm_v128_load(a + 8), wasm_v128_load(a + 12) };
+    const v128_t r0 = mulCol(c, b), r1 = mulCol(c, b + 4), r2 = mulCol(c, b + 8), r3 = mulCol(c, b + 12);
+    wasm_v128_store(r, r0); wasm_v128_store(r + 4, r1); wasm_v128_store(r + 8, r2); wasm_v128_store(r + 12, r3);
+    return true; }
+inline bool mulMat4Vec4(const float *m, const float *v, float *r) {
+    const v128_t c[4] = { wasm_v128_load(m), wasm_v128_load(m + 4), wasm_v128_load(m + 8), wasm_v128_load(m + 12) };
+    wasm_v128_store(r, mulCol(c, v));
+    return true; }
+// dst[i] = q * (src[i] * s), 4 vec3 at time (3 loads ==> SoA ==> 3 stores), returns processed count
+inline size_t transform(const float *q, const float *src, float s, float *dst, size_t count) {
+    const v128_t qx = wasm_f32x4_splat(q[0]), qy = wasm_f32x4_splat(q[1]), qz = wasm_f32x4_splat(q[2]), qw = wasm_f32x4_splat(q[3]);
+    const v128_t vs = wasm_f32x4_splat(s), two = wasm_f32x4_splat(2.f);
+    const size_t n = count & ~size_t(3);
+    for(size_t i = 0; i < n; i += 4, src += 12, dst += 12) {
+        const v128_t a = wasm_v128_load(src), b = wasm_v128_load(src + 4), c = wasm_v128_load(src + 8);  // x0 y0 z0 x1 | y1 z1 x2 y2 | z2 x3 y3 z3
+        const v128_t vx = wasm_f32x4_mul(VGM_SHUF(VGM_SHUF(a, b, 0, 3, 6, 0), c, 0, 1, 2, 5), vs);
+        const v128_t vy = wasm_f32x4_mul(VGM_SHUF(VGM_SHUF(a, b, 1, 4, 7, 0), c, 0, 1, 2, 6), vs);
+        const v128_t vz = wasm_f32x4_mul(VGM_SHUF(VGM_SHUF(a, b, 2, 5, 0, 0), c, 0, 1, 4, 7), vs);
+        const v128_t ux = wasm_f32x4_sub(wasm_f32x4_mul(qy, vz), wasm_f32x4_mul(qz, vy));
+        const v128_t uy = wasm_f32x4_sub(wasm_f32x4_mul(qz, vx), wasm_f32x4_mul(qx, vz));
+        const v128_t uz = wasm_f32x4_sub(wasm_f32x4_mul(qx, vy), wasm_f32x4_mul(qy, vx));
+        const v128_t cx = wasm_f32x4_sub(wasm_f32x4_mul(qy, uz), wasm_f32x4_mul(qz, uy));
+        const v128_t cy = wasm_f32x4_sub(wasm_f32x4_mul(qz, ux), wasm_f32x4_mul(qx, uz));
+        const v128_t cz = wasm_f32x4_sub(wasm_f32x4_mul(qx, uy), wasm_f32x4_mul(qy, ux));
+        const v128_t rx = wasm_f32x4_add(vx, wasm_f32x4_mul(wasm_f32x4_add(wasm_f32x4_mul(ux, qw), cx), two));
+        const v128_t ry = wasm_f32x4_add(vy, wasm_f32x4_mul(wasm_f32x4_add(wasm_f32x4_mul(uy, qw), cy), two));
+        const v128_t rz = wasm_f32x4_add(vz, wasm_f32x4_mul(wasm_f32x4_add(wasm_f32x4_mul(uz, qw), cz), two));
+        const v128_t xyLo = VGM_SHUF(rx, ry, 0, 4, 1, 5), yz = VGM_SHUF(ry, rz, 1, 5, 2, 6), xyHi = VGM_SHUF(rx, ry, 3, 7, 0, 0);
+        wasm_v128_store(dst,     VGM_SHUF(xyLo, rz, 0, 1, 4, 2));    // x0 y0 z0 x1
+        wasm_v128_store(dst + 4, VGM_SHUF(yz,   rx, 0, 1, 6, 2));    // y1 z1 x2 y2
+        wasm_v128_store(dst + 8, VGM_SHUF(xyHi, rz, 6, 0, 1, 7));    // z2 x3 y3 z3
+    }
+    return n; }
+#undef VGM_SHUF
+} // end namespace simd128
+#endif
+
 // Vec2
 //////////////////////////
 TEMPLATE_TYPENAME_T class Vec2 {
@@ -331,7 +396,11 @@ public:
     Mat4 operator*(T s)           const { return { v[0] * s     , v[1] * s     , v[2] * s     , v[3] * s      }; }
     Mat4 operator/(T s)           const { return { v[0] / s     , v[1] / s     , v[2] / s     , v[3] / s      }; }
 #define M(X,Y) (m##X * m.m##Y)
-    Mat4 operator*(const Mat4& m) const { return { M(00,00) + M(10,01) + M(20,02) + M(30,03),
+    Mat4 operator*(const Mat4& m) const {
+#ifdef VGM_USES_WASM_SIMD
+                                          Mat4 r; if(simd128::mulMat4(&m00, &m.m00, &r.m00)) return r;
+#endif
+                                          return { M(00,00) + M(10,01) + M(20,02) + M(30,03),
                                                    M(01,00) + M(11,01) + M(21,02) + M(31,03),
                                                    M(02,00) + M(12,01) + M(22,02) + M(32,03),
                                                    M(03,00) + M(13,01) + M(23,02) + M(33,03),
@@ -348,7 +417,11 @@ public:
                                                    M(02,30) + M(12,31) + M(22,32) + M(32,33),
                                                    M(03,30) + M(13,31) + M(23,32) + M(33,33) };  }
 #undef M
-    VEC4_T operator*(const VEC4_T& v) const { return { m00 * v.x + m10 * v.y + m20 * v.z + m30 * v.w,
+    VEC4_T operator*(const VEC4_T& v) const {
+#ifdef VGM_USES_WASM_SIMD
+                                          VEC4_T r; if(simd128::mulMat4Vec4(&m00, &v.x, &r.x)) return r;
+#endif
+                                          return { m00 * v.x + m10 * v.y + m20 * v.z + m30 * v.w,
                                                        m01 * v.x + m11 * v.y + m21 * v.z + m31 * v.w,
                                                        m02 * v.x + m12 * v.y + m22 * v.z + m32 * v.w,
                                                        m03 * v.x + m13 * v.y + m23 * v.z + m33 * v.w }; }
@@ -376,8 +449,58 @@ TEMPLATE_TYPENAME_T inline MAT4_T mat4_cast(QUAT_T const& q) { return MAT3_T(q);
 TEMPLATE_TYPENAME_T inline VEC3_T getTranslationVec(const MAT4_T& m) { return { m.v[3] }; }
 
 
-inline float uintBitsToFloat(uint32_t const v) { return *((float *)(&v)); }
-inline uint32_t floatBitsToUint(float const v) { return *((uint32_t *)(&v)); }
+// bits copy (no pointer cast: strict aliasing), memcpy is a single move when optimized
+inline float uintBitsToFloat(uint32_t const v) { float f; std::memcpy(&f, &v, sizeof(f)); return f; }
+inline uint32_t floatBitsToUint(float const v) { uint32_t u; std::memcpy(&u, &v, sizeof(u)); return u; }
+// fast math
+//  polynomial approximations (float only) used by the transcendental policy
+//  (below) when VGM_FAST_MATH is defined: read vgMath_config.h for max errors
+//////////////////////////
+inline void fastSinCos(float const a, float &s, float &c) {      // valid for |a| < 1e5
+    const float j = float(int(a * 0.63661977236f + (a >= 0.f ? .5f : -.5f))); // quadrant
+    const float r = ((a - j * 1.5703125f) - j * 4.837512969970703125e-4f) - j * 7.54978995489188216e-8f; // Cody-Waite pi/2
+    const float r2 = r * r;                                                    // credits: cephes sinf/cosf coeffs
+    const float ps = r + r * r2 * (-1.6666654611e-1f + r2 * (8.3321608736e-3f + r2 * -1.9515295891e-4f));
+    const float pc = 1.f - .5f * r2 + r2 * r2 * (4.166664568298827e-2f + r2 * (-1.388731625493765e-3f + r2 * 2.443315711809948e-5f));
+    const int q = int(j) & 3;
+    s = (q & 1) ? pc : ps;  if(q & 2)       s = -s;
+    c = (q & 1) ? ps : pc;  if((q + 1) & 2) c = -c; }
+inline float fastInvSqrt(float const x) {
+#if defined(__SSE__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 1)
+    const float y = _mm_cvtss_f32(_mm_rsqrt_ss(_mm_set_ss(x)));                // 12 bit estimate
+    return y * (1.5f - .5f * x * y * y);                                       // + 1 Newton step
+#else
+    float y = uintBitsToFloat(0x5f375a86u - (floatBitsToUint(x) >> 1));        // bit estimate
+    y *= 1.5f - .5f * x * y * y;                                               // + 2 Newton steps
+    return y * (1.5f - .5f * x * y * y);
+#endif
+}
+inline float fastSqrt(float const x) { return x > 0.f ? x * fastInvSqrt(x) : 0.f; }
+inline float fastAcos(float const x) {                            // credits: Abramowitz & Stegun 4.4.46
+    const float a = x < 0.f ? (x < -1.f ? 1.f : -x) : (x > 1.f ? 1.f : x);
+    const float p = 1.5707963050f + a * (-0.2145988016f + a * (0.0889789874f + a * (-0.0501743046f +
+                                    a * (0.0308918810f + a * (-0.0170881256f + a * (0.0066700901f + a * -0.0012624911f))))));
+    const float r = fastSqrt(1.f - a) * p;
+    return x < 0.f ? 3.14159265359f - r : r; }
+
+// transcendental policy
+//  VGM_FAST_MATH ==> float uses fast approximations, double always uses libm
+//////////////////////////
+#ifdef VGM_FAST_MATH
+inline void  tSinCos (float  const a, float  &s, float  &c) { fastSinCos(a, s, c); }
+inline float tTan    (float  const a) { float s, c; fastSinCos(a, s, c); return s / c; }
+inline float tAcos   (float  const x) { return fastAcos(x); }
+inline float tInvSqrt(float  const x) { return fastInvSqrt(x); }
+#else
+inline void  tSinCos (float  const a, float  &s, float  &c) { s = sin(a); c = cos(a); }
+inline float tTan    (float  const a) { return tan(a); }
+inline float tAcos   (float  const x) { return acos(x); }
+inline float tInvSqrt(float  const x) { return 1.f / sqrt(x); }
+#endif
+inline void   tSinCos (double const a, double &s, double &c) { s = sin(a); c = cos(a); }
+inline double tTan    (double const a) { return tan(a); }
+inline double tAcos   (double const x) { return acos(x); }
+inline double tInvSqrt(double const x) { return 1. / sqrt(x); }
 // dot
 //////////////////////////
 TEMPLATE_TYPENAME_T inline T dot(const VEC2_T& v0, const VEC2_T& v1) { return v0.x * v1.x + v0.y * v1.y; }
@@ -411,10 +534,17 @@ TEMPLATE_TYPENAME_T inline QUAT_T abs(const QUAT_T& q) { return { tAbs(q.w), tAb
 TEMPLATE_TYPENAME_T inline T sign(const T v) { return v>T(0) ? T(1) : ( v<T(0) ? T(-1) : T(0)); }
 // normalize
 //////////////////////////
+#ifdef VGM_FAST_MATH
+TEMPLATE_TYPENAME_T inline VEC2_T normalize(const VEC2_T& v) { return v * tInvSqrt(dot(v, v)); }
+TEMPLATE_TYPENAME_T inline VEC3_T normalize(const VEC3_T& v) { return v * tInvSqrt(dot(v, v)); }
+TEMPLATE_TYPENAME_T inline VEC4_T normalize(const VEC4_T& v) { return v * tInvSqrt(dot(v, v)); }
+TEMPLATE_TYPENAME_T inline QUAT_T normalize(const QUAT_T& q) { return q * tInvSqrt(dot(q, q)); }
+#else
 TEMPLATE_TYPENAME_T inline VEC2_T normalize(const VEC2_T& v) { return v / length(v); }
 TEMPLATE_TYPENAME_T inline VEC3_T normalize(const VEC3_T& v) { return v / length(v); }
 TEMPLATE_TYPENAME_T inline VEC4_T normalize(const VEC4_T& v) { return v / length(v); }
 TEMPLATE_TYPENAME_T inline QUAT_T normalize(const QUAT_T& q) { return q / length(q); }
+#endif
 TEMPLATE_TYPENAME_T inline MAT3_T normalize(const MAT3_T& m) { return m / sqrt(dot(m.v[0],m.v[0])+dot(m.v[1],m.v[1])+dot(m.v[2],m.v[2])); }
 TEMPLATE_TYPENAME_T inline MAT3_T normalize(const MAT4_T& m) { return m / sqrt(dot(m.v[0],m.v[0])+dot(m.v[1],m.v[1])+dot(m.v[2],m.v[2])+dot(m.v[3],m.v[3])); }
 // mix
@@ -512,6 +642,15 @@ TEMPLATE_TYPENAME_T inline VEC3_T operator*(const QUAT_T& q, const VEC3_T& v) {
     const VEC3_T qV(q.x, q.y, q.z), uv(cross(qV, v));
     return v + ((uv * q.w) + cross(qV, uv)) * T(2); }
 TEMPLATE_TYPENAME_T inline  VEC3_T operator*(const VEC3_T& v, const QUAT_T& q) {  return inverse(q) * v; }
+// rotation + scale: batch
+//  dst[i] = q * (src[i] * s) on contiguous arrays (src == dst allowed), 4 vertices at time with wasm_simd128
+//////////////////////////
+TEMPLATE_TYPENAME_T inline void transform(QUAT_T const& q, const VEC3_T *src, T const s, VEC3_T *dst, size_t count) {
+    size_t i = 0;
+#ifdef VGM_USES_WASM_SIMD
+    i = simd128::transform(&q.x, &src->x, s, &dst->x, count);
+#endif
+    for(; i < count; i++) dst[i] = q * (src[i] * s); }
 // translate / scale / rotate
 //////////////////////////
 TEMPLATE_TYPENAME_T inline MAT4_T translate(MAT4_T const& m, VEC3_T const& v) {
@@ -521,7 +660,7 @@ TEMPLATE_TYPENAME_T inline MAT4_T scale(MAT4_T const& m, VEC3_T const& v) {
     return MAT4_T(m[0] * v[0], m[1] * v[1], m[2] * v[2], m[3]); }
 
 TEMPLATE_TYPENAME_T inline MAT4_T rotate(MAT4_T const& m, const T a, VEC3_T const& v) {
-    T const c = cos(a), s = sin(a);
+    T c, s; tSinCos(a, s, c);
     VEC3_T axis { normalize(v) }, t { (T(1) - c) * axis };
 
     MAT3_T rot = { { c + t.x * axis.x,          t.x * axis.y + s * axis.z, t.x * axis.z - s * axis.y },
@@ -535,16 +674,16 @@ TEMPLATE_TYPENAME_T inline MAT4_T rotate(MAT4_T const& m, const T a, VEC3_T cons
 }
 // quat angle/axis
 //////////////////////////
-TEMPLATE_TYPENAME_T inline QUAT_T angleAxis(T const &a, VEC3_T const &v) { return QUAT_T(cos(a * T(0.5)), v * sin(a * T(0.5))); }
-TEMPLATE_TYPENAME_T inline T angle(QUAT_T const& q) { return acos(q.w) * T(2); }
+TEMPLATE_TYPENAME_T inline QUAT_T angleAxis(T const &a, VEC3_T const &v) { T s, c; tSinCos(a * T(0.5), s, c); return QUAT_T(c, v * s); }
+TEMPLATE_TYPENAME_T inline T angle(QUAT_T const& q) { return tAcos(q.w) * T(2); }
 TEMPLATE_TYPENAME_T inline VEC3_T axis(QUAT_T const& q) {
     const T t1 = T(1) - q.w * q.w; if(t1 <= T(0)) return VEC3_T(0, 0, 1);
-    const T t2 = T(1) / sqrt(t1);  return VEC3_T(q.x * t2, q.y * t2, q.z * t2); }
+    const T t2 = tInvSqrt(t1);     return VEC3_T(q.x * t2, q.y * t2, q.z * t2); }
 
 TEMPLATE_TYPENAME_T inline MAT4_T eulerAngleXYZ(T const& t1, T const& t2, T const& t3) {
-        T c1 = cos(-t1), s1 = sin(-t1);
-        T c2 = cos(-t2), s2 = sin(-t2);
-        T c3 = cos(-t3), s3 = sin(-t3);
+        T c1, s1; tSinCos(-t1, s1, c1);
+        T c2, s2; tSinCos(-t2, s2, c2);
+        T c3, s3; tSinCos(-t3, s3, c3);
 
         return { c2*c3, -c1*s3 + s1*s2*c3,  s1*s3 + c1*s2*c3, T(0),
                  c2*s3,  c1*c3 + s1*s2*s3, -s1*c3 + c1*s2*s3, T(0),
@@ -560,6 +699,62 @@ TEMPLATE_TYPENAME_T inline T degrees(T r) { return r * T(57.29577951308232087679
 TEMPLATE_TYPENAME_T inline T pi() { return T(3.1415926535897932384626433832795029); }
 TEMPLATE_TYPENAME_T inline T one_over_pi() { return T(0.318309886183790671537767526745028724); }
 
+// quat log / exp / pow
+//////////////////////////
+TEMPLATE_TYPENAME_T inline QUAT_T log(QUAT_T const& q) {
+    const T vLen = sqrt(q.x * q.x + q.y * q.y + q.z * q.z);
+    if(vLen < std::numeric_limits<T>::epsilon()) return QUAT_T(std::log(tAbs(q.w)), q.w < T(0) ? T_PI : T(0), T(0), T(0));
+    const T t = std::atan2(vLen, q.w) / vLen;
+    return QUAT_T(T(.5) * std::log(vLen * vLen + q.w * q.w), q.x * t, q.y * t, q.z * t); }
+TEMPLATE_TYPENAME_T inline QUAT_T exp(QUAT_T const& q) {
+    const T a = sqrt(q.x * q.x + q.y * q.y + q.z * q.z), e = std::exp(q.w);
+    T s, c; tSinCos(a, s, c);
+    const T k = a < std::numeric_limits<T>::epsilon() ? e : e * s / a;
+    return QUAT_T(e * c, q.x * k, q.y * k, q.z * k); }
+TEMPLATE_TYPENAME_T inline QUAT_T pow(QUAT_T const& q, T const y) { return exp(log(q) * y); }
+// quat interpolation
+//  mix    ==> spherical interpolation w/o shortest path (as glm::mix)
+//  slerp  ==> spherical interpolation, shortest path
+//  nlerp  ==> normalized linear interpolation, shortest path: faster, non constant velocity
+//  squad  ==> spherical cubic interpolation between q1 and q2, with s1 / s2 control
+//             points from intermediate(prev, curr, next)
+//  angleBetween ==> rotation angle [0, pi] between two unit quaternions orientations
+//////////////////////////
+TEMPLATE_TYPENAME_T inline QUAT_T slerp_call(QUAT_T const& x, QUAT_T const& z, T const cosTheta, T const a) {
+    if(cosTheta > T(1) - std::numeric_limits<T>::epsilon())                   // too close: linear interpolation
+        return QUAT_T(mix(x.w, z.w, a), mix(x.x, z.x, a), mix(x.y, z.y, a), mix(x.z, z.z, a));
+    const T theta = tAcos(cosTheta), invSinTheta = tInvSqrt((T(1) - cosTheta) * (T(1) + cosTheta)); // not 1 - c*c: cancellation
+    T s0, s1, c; tSinCos((T(1) - a) * theta, s0, c); tSinCos(a * theta, s1, c);
+    return (x * s0 + z * s1) * invSinTheta; }
+TEMPLATE_TYPENAME_T inline QUAT_T mix(QUAT_T const& x, QUAT_T const& y, T const a) { return slerp_call(x, y, dot(x, y), a); }
+TEMPLATE_TYPENAME_T inline QUAT_T slerp(QUAT_T const& x, QUAT_T const& y, T const a) {
+    const T cosTheta = dot(x, y);
+    return cosTheta < T(0) ? slerp_call(x, -y, -cosTheta, a) : slerp_call(x, y, cosTheta, a); }
+TEMPLATE_TYPENAME_T inline QUAT_T nlerp(QUAT_T const& x, QUAT_T const& y, T const a) {
+    return normalize(x + ((dot(x, y) < T(0) ? -y : y) - x) * a); }
+TEMPLATE_TYPENAME_T inline QUAT_T intermediate(QUAT_T const& prev, QUAT_T const& curr, QUAT_T const& next) {
+    const QUAT_T invQ(inverse(curr));
+    return exp((log(next * invQ) + log(prev * invQ)) * T(-.25)) * curr; }
+TEMPLATE_TYPENAME_T inline QUAT_T squad(QUAT_T const& q1, QUAT_T const& q2, QUAT_T const& s1, QUAT_T const& s2, T const h) {
+    return mix(mix(q1, q2, h), mix(s1, s2, h), T(2) * (T(1) - h) * h); }
+TEMPLATE_TYPENAME_T inline T angleBetween(QUAT_T const& x, QUAT_T const& y) {
+    const T d = tAbs(dot(x, y));
+    return tAcos(d > T(1) ? T(1) : d) * T(2); }
+// quat interpolation: batch
+//  contiguous arrays, same factor "a" for all
+//  slerp ==> one scalar slerp for element (acos, sin/cos, lerp branch): not vectorized
+//  nlerp ==> loop body without branches (sign by copysign): the loop is auto-vectorized
+//            only if sqrt can't set errno (GCC/Clang: -O3 -fno-math-errno), else SLP of the body
+//////////////////////////
+TEMPLATE_TYPENAME_T inline void slerp(const QUAT_T *x, const QUAT_T *y, T const a, QUAT_T *dst, size_t count) {
+    for(size_t i = 0; i < count; i++) dst[i] = slerp(x[i], y[i], a); }
+TEMPLATE_TYPENAME_T inline void nlerp(const QUAT_T *x, const QUAT_T *y, T const a, QUAT_T *dst, size_t count) {
+    const T b = T(1) - a;
+    for(size_t i = 0; i < count; i++) {
+        const T s = std::copysign(a, dot(x[i], y[i]));                        // shortest path
+        const QUAT_T q(x[i].w * b + y[i].w * s, x[i].x * b + y[i].x * s, x[i].y * b + y[i].y * s, x[i].z * b + y[i].z * s);
+        dst[i] = q * (T(1) / std::sqrt(dot(q, q))); } }
+
 // lookAt
 //////////////////////////
 TEMPLATE_TYPENAME_T inline MAT4_T lookAtLH(const VEC3_T& pov, const VEC3_T& tgt, const VEC3_T& up)
@@ -622,7 +817,7 @@ TEMPLATE_TYPENAME_T inline MAT4_T ortho     (cT l, cT r, cT b, cT t, cT n, cT f)
 TEMPLATE_TYPENAME_T inline MAT4_T perspective_call(cT fov, cT a, cT K, cT f_n, cT fn_fMn)
 {
     assert(std::abs(a - std::numeric_limits<T>::epsilon()) > T(0));
-    const T hFov = tan(fov * T(.5));
+    const T hFov = tTan(fov * T(.5));
     return { T(1)/(a*hFov),  T(0),           T(0),      T(0),
                T(0),        T(1)/(hFov),     T(0),      T(0),
                T(0),          T(0),           f_n,        K ,
@@ -679,6 +874,128 @@ TEMPLATE_TYPENAME_T inline MAT4_T frustum     (cT l, cT r, cT b, cT t, cT n, cT
 }
 #undef cT
 
+// packing / quantization
+//  compact encodings to store or stream orientations and directions
+//
+//  half float ==> IEEE 754 binary16, round to nearest even (Inf/NaN preserved)
+//  oct        ==> octahedral map of a direction (vector length is NOT stored)
+//                 max angular error: 2x16 ~0.004 deg, 2x8 ~1 deg
+//  packQuat   ==> "smallest three": index of largest component (2 bit) +
+//                 3 remaining components in [-1/sqrt2, 1/sqrt2]
+//                 max angle() error: 32bit (3x10) ~0.26 deg
+//                                    48bit (3x15) ~0.008 deg
+//                                    64bit (3x20) ~0.0003 deg
+//                 q and -q are same rotation: unpacked quat can have opposite sign
+//  Batch overloads (pointer, pointer, count) are scalar loops, one element for
+//  iteration (no SIMD kernels): bodies without data dependent branches (random
+//  signs / largest component), so loops are pipelined and never mispredicted
+//  Bounds and throughput: examples/tools/vgPackTest
+//
+//  With VGM_USES_TEMPLATE the unpack functions return float types by default:
+//      unpackQuat32(v) ==> quat      unpackQuat32<double>(v) ==> dquat
+//////////////////////////
+#ifdef VGM_USES_TEMPLATE
+    #define TEMPLATE_TYPENAME_T_DEF template<typename T = float>
+    #define T_ARG <T>
+#else
+    #define TEMPLATE_TYPENAME_T_DEF
+    #define T_ARG
+#endif
+inline uint16_t packHalf1x16(float const v) {   // credits: F.Giesen, float_to_half_fast3_rtne
+    uint32_t f = floatBitsToUint(v);
+    const uint32_t sign = f & 0x80000000u; f ^= sign;
+    uint32_t h;
+    if(f >= 0x47800000u)        h = (f > 0x7f800000u) ? 0x7e00u : 0x7c00u;    // NaN : Inf (or overflow)
+    else if(f < 0x38800000u)    h = floatBitsToUint(uintBitsToFloat(f) + uintBitsToFloat(0x3f000000u)) - 0x3f000000u; // denormal / zero
+    else                        h = (f + 0xc8000fffu + ((f >> 13) & 1)) >> 13; // rebias exponent + round to nearest even
+    return uint16_t(h | (sign >> 16)); }
+inline float unpackHalf1x16(uint16_t const v) {
+    uint32_t f = uint32_t(v & 0x7fff) << 13;
+    const uint32_t exp = f & 0x0f800000u;
+    f += 0x38000000u;                                                          // rebias exponent
+    if(exp == 0x0f800000u) f += 0x38000000u;                                   // Inf / NaN
+    else if(exp == 0) f = floatBitsToUint(uintBitsToFloat(f + 0x00800000u) - uintBitsToFloat(0x38800000u)); // denormal / zero
+    return uintBitsToFloat(f | (uint32_t(v & 0x8000) << 16)); }
+
+TEMPLATE_TYPENAME_T inline uint32_t packHalf2x16(const VEC2_T& v) { return uint32_t(packHalf1x16(float(v.x))) | uint32_t(packHalf1x16(float(v.y))) << 16; }
+TEMPLATE_TYPENAME_T inline uint64_t packHalf3x16(const VEC3_T& v) { return uint64_t(packHalf1x16(float(v.x))) | uint64_t(packHalf1x16(float(v.y))) << 16 | uint64_t(packHalf1x16(float(v.z))) << 32; }
+TEMPLATE_TYPENAME_T inline uint64_t packHalf4x16(const VEC4_T& v) { return packHalf3x16(VEC3_T(v)) | uint64_t(packHalf1x16(float(v.w))) << 48; }
+TEMPLATE_TYPENAME_T_DEF inline VEC2_T unpackHalf2x16(uint32_t const v) { return { T(unpackHalf1x16(uint16_t(v))), T(unpackHalf1x16(uint16_t(v >> 16))) }; }
+TEMPLATE_TYPENAME_T_DEF inline VEC3_T unpackHalf3x16(uint64_t const v) { return { T(unpackHalf1x16(uint16_t(v))), T(unpackHalf1x16(uint16_t(v >> 16))), T(unpackHalf1x16(uint16_t(v >> 32))) }; }
+TEMPLATE_TYPENAME_T_DEF inline VEC4_T unpackHalf4x16(uint64_t const v) { return VEC4_T(unpackHalf3x16 T_ARG(v), T(unpackHalf1x16(uint16_t(v >> 48)))); }
+
+TEMPLATE_TYPENAME_T inline VEC2_T octEncode(const VEC3_T& v) {
+    const VEC3_T n(v / (std::abs(v.x) + std::abs(v.y) + std::abs(v.z)));
+    const T sx = n.x >= T(0) ? T(1) : T(-1), sy = n.y >= T(0) ? T(1) : T(-1);
+    return n.z >= T(0) ? VEC2_T(n.x, n.y) : VEC2_T((T(1) - std::abs(n.y)) * sx, (T(1) - std::abs(n.x)) * sy); }
+TEMPLATE_TYPENAME_T inline VEC3_T octDecode(const VEC2_T& e) {
+    VEC3_T n(e.x, e.y, T(1) - std::abs(e.x) - std::abs(e.y));
+    const T t = n.z < T(0) ? -n.z : T(0);
+    n.x += n.x >= T(0) ? -t : t; n.y += n.y >= T(0) ? -t : t;
+    return normalize(n); }
+TEMPLATE_TYPENAME_T inline uint32_t packSnorm1xN(T const v, T const maxV) {  // [-1, 1] ==> [0, 2*maxV]
+    const T c = v < T(-1) ? T(-1) : (v > T(1) ? T(1) : v);
+    return uint32_t(c * maxV + maxV + T(.5)); }
+TEMPLATE_TYPENAME_T inline T unpackSnorm1xN(uint32_t const v, T const maxV) { return (T(v) - maxV) / maxV; }
+
+TEMPLATE_TYPENAME_T inline uint32_t packOct2x16(const VEC3_T& v) {
+    const VEC2_T e(octEncode(v));
+    return packSnorm1xN(e.x, T(32767)) | packSnorm1xN(e.y, T(32767)) << 16; }
+TEMPLATE_TYPENAME_T inline uint16_t packOct2x8(const VEC3_T& v) {
+    const VEC2_T e(octEncode(v));
+    return uint16_t(packSnorm1xN(e.x, T(127)) | packSnorm1xN(e.y, T(127)) << 8); }
+TEMPLATE_TYPENAME_T_DEF inline VEC3_T unpackOct2x16(uint32_t const v) { return octDecode(VEC2_T(unpackSnorm1xN(v & 0xffff, T(32767)), unpackSnorm1xN(v >> 16, T(32767)))); }
+TEMPLATE_TYPENAME_T_DEF inline VEC3_T unpackOct2x8 (uint16_t const v) { return octDecode(VEC2_T(unpackSnorm1xN(v & 0xff, T(127)), unpackSnorm1xN(uint32_t(v) >> 8, T(127)))); }
+
+TEMPLATE_TYPENAME_T inline uint64_t packQuat_call(const QUAT_T& q, const int bits) {
+    static const uint8_t others[4][3] = { { 1, 2, 3 }, { 0, 2, 3 }, { 0, 1, 3 }, { 0, 1, 2 } };
+    const T ax = std::abs(q.x), ay = std::abs(q.y), az = std::abs(q.z), aw = std::abs(q.w); // no branches (tAbs is a compare):
+    const int mxy = int(ay > ax), mzw = 2 + int(aw > az);                      // signs and index of largest are random
+    const int zw = int((ax > ay ? ax : ay) < (az > aw ? az : aw));            // maxss
+    const int m = mxy + zw * (mzw - mxy);
+    const uint64_t maxV = (uint64_t(1) << bits) - 2;                           // odd levels: 0 is exact
+    const T h = T(maxV) * T(.5), k = (q[m] < T(0) ? -h : h) * T(1.41421356237309504880); // largest component always positive
+    uint64_t packed = uint64_t(m) << (3 * bits);                               // [-1/sqrt2, 1/sqrt2] ==> [0, maxV]
+    for(int i = 0; i < 3; i++) {
+        const T c = q[others[m][i]] * k + h + T(.5);
+        packed |= uint64_t(int32_t(c < T(0) ? T(0) : (c > T(maxV) ? T(maxV) : c))) << ((2 - i) * bits); // < 2^21: int32 conversion
+    }
+    return packed; }
+TEMPLATE_TYPENAME_T_DEF inline QUAT_T unpackQuat_call(uint64_t const v, const int bits) {
+    static const uint8_t others[4][3] = { { 1, 2, 3 }, { 0, 2, 3 }, { 0, 1, 3 }, { 0, 1, 2 } };
+    const uint64_t maxV = (uint64_t(1) << bits) - 2, mask = maxV | 1;
+    const T k = T(1) / (T(maxV) * T(0.70710678118654752440)), h = T(maxV) * T(.5);
+    const int m = int(v >> (3 * bits)) & 3;
+    const T a = (T(int32_t((v >> (2 * bits)) & mask)) - h) * k, b = (T(int32_t((v >> bits) & mask)) - h) * k, c = (T(int32_t(v & mask)) - h) * k;
+    const T sum = a * a + b * b + c * c;
+    QUAT_T q;
+    q[others[m][0]] = a; q[others[m][1]] = b; q[others[m][2]] = c;
+    q[m] = sqrt(sum < T(1) ? T(1) - sum : T(0));
+    return q; }
+
+TEMPLATE_TYPENAME_T inline uint32_t packQuat32(const QUAT_T& q) { return uint32_t(packQuat_call(q, 10)); }
+TEMPLATE_TYPENAME_T inline uint64_t packQuat48(const QUAT_T& q) { return packQuat_call(q, 15); }  // uses lower 48 bits
+TEMPLATE_TYPENAME_T inline uint64_t packQuat64(const QUAT_T& q) { return packQuat_call(q, 20); }
+TEMPLATE_TYPENAME_T_DEF inline QUAT_T unpackQuat32(uint32_t const v) { return unpackQuat_call T_ARG(v, 10); }
+TEMPLATE_TYPENAME_T_DEF inline QUAT_T unpackQuat48(uint64_t const v) { return unpackQuat_call T_ARG(v & 0xffffffffffffull, 15); }
+TEMPLATE_TYPENAME_T_DEF inline QUAT_T unpackQuat64(uint64_t const v) { return unpackQuat_call T_ARG(v, 20); }
+
+// packing / quantization: batch
+//////////////////////////
+#define VGM_PACK_BATCH(FUNC, SRC, DST) TEMPLATE_TYPENAME_T inline void FUNC(const SRC *src, DST *dst, size_t count) { for(size_t i = 0; i < count; i++) dst[i] = FUNC(src[i]); }
+#define VGM_UNPACK_BATCH(FUNC, SRC, DST) TEMPLATE_TYPENAME_T inline void FUNC(const SRC *src, DST *dst, size_t count) { for(size_t i = 0; i < count; i++) dst[i] = FUNC T_ARG(src[i]); }
+VGM_PACK_BATCH(packHalf3x16, VEC3_T, uint64_t)      VGM_UNPACK_BATCH(unpackHalf3x16, uint64_t, VEC3_T)
+VGM_PACK_BATCH(packHalf4x16, VEC4_T, uint64_t)      VGM_UNPACK_BATCH(unpackHalf4x16, uint64_t, VEC4_T)
+VGM_PACK_BATCH(packOct2x16 , VEC3_T, uint32_t)      VGM_UNPACK_BATCH(unpackOct2x16 , uint32_t, VEC3_T)
+VGM_PACK_BATCH(packOct2x8  , VEC3_T, uint16_t)      VGM_UNPACK_BATCH(unpackOct2x8  , uint16_t, VEC3_T)
+VGM_PACK_BATCH(packQuat32  , QUAT_T, uint32_t)      VGM_UNPACK_BATCH(unpackQuat32  , uint32_t, QUAT_T)
+VGM_PACK_BATCH(packQuat48  , QUAT_T, uint64_t)      VGM_UNPACK_BATCH(unpackQuat48  , uint64_t, QUAT_T)
+VGM_PACK_BATCH(packQuat64  , QUAT_T, uint64_t)      VGM_UNPACK_BATCH(unpackQuat64  , uint64_t, QUAT_T)
+#undef VGM_PACK_BATCH
+#undef VGM_UNPACK_BATCH
+#undef TEMPLATE_TYPENAME_T_DEF
+#undef T_ARG
+
 } // end namespace vgm
 
 #ifdef VGM_USES_TEMPLATE
@@ -127,5 +127,28 @@
 //------------------------------------------------------------------------------
 //#define VGM_USES_ZERO_ONE_ZBUFFER
 
+//------------------------------------------------------------------------------
+// uncomment to use FAST approximated transcendental functions (float only)
+//
+// sin / cos / tan / acos / inverse sqrt, used by:
+//      angleAxis, angle, axis, rotate, eulerAngleXYZ, perspective, normalize
+//      and the virtualGizmo3D trackball
+// are replaced by polynomial approximations (sin & cos evaluated together)
+// and by rsqrt estimate + Newton step
+//
+//  Max error versus libm (double reference), examples/tools/fastMathTest:
+//      sin / cos    : 9.3e-8 abs    (|angle| < 1e4, valid up to |angle| < 1e5)
+//      acos         : 6.3e-7 abs
+//      inverse sqrt : 2.7e-7 rel    SSE rsqrt + 1 Newton step
+//                     4.8e-6 rel    w/o SSE: bit estimate + 2 Newton steps
+//  x86-64, -O2: sincos ~18 ==> ~5 ns, acos ~19 ==> ~13 ns, but the trackball
+//      is not bound by them: vGizmo3D::motion() ~230 ==> ~207 ns (-10%)
+//
+// double types always use libm functions
+//
+// Default ==> libm functions
+//------------------------------------------------------------------------------
+//#define VGM_FAST_MATH
+
 //  v g M a t h   C O N F I G   end
 ////////////////////////////////////////////////////////////////////////////////
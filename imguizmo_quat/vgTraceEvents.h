@@ -0,0 +1,157 @@
+//------------------------------------------------------------------------------
+//  Copyright (c) 2025 Michele Morrone
+//  All rights reserved.
+//
+//  https://michelemorrone.eu - https://brutpitt.com
+//
+//  X: https://x.com/BrutPitt - GitHub: https://github.com/BrutPitt
+//
+//  direct mail: brutpitt(at)gmail.com - me(at)michelemorrone.eu
+//
+//  This software is distributed under the terms of the BSD 2-Clause license
+//------------------------------------------------------------------------------
+#pragma once
+
+// Trace-event zones: timeline of vGizmo3D / imGuIZMO.quat time inside the frames
+//
+//  Compiled out by default: #define VGIZMO_TRACE_EVENTS (vGizmo3D_config.h or
+//  compiler directive) to enable them, otherwise all macros are empty
+//
+//      VGIZMO_ZONE("name");                 ==> zone from here to end of scope
+//      VGIZMO_ZONE_BEGIN(var, "name");      ==> sequential zones in same scope
+//      VGIZMO_ZONE_END(var);
+//
+//  name: string literal (only the pointer is stored)
+//
+//  Sink (where completed zones go), pluggable:
+//      vgTrace::setSink(func, userData) ==> func(name, beginNs, endNs, userData)
+//          called from the thread of the zone (sink must be thread safe)
+//      vgTrace::setSink(nullptr)        ==> built-in (default): lock-free per
+//          thread buffers (fixed size, zones over capacity are dropped and
+//          counted), then written as Chrome trace-event JSON, to open in
+//          Perfetto (ui.perfetto.dev) or chrome://tracing
+//              vgTrace::writeChromeJson("gizmo.json");
+//
+//  Timestamps: std::chrono::steady_clock, ns from first use
+//------------------------------------------------------------------------------
+#if defined(VGIZMO_TRACE_EVENTS)
+
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdint>
+
+#ifndef VGIZMO_TRACE_EVENTS_PER_THREAD
+    #define VGIZMO_TRACE_EVENTS_PER_THREAD (1 << 16)    // built-in sink: zones for thread (24 bytes each)
+#endif
+
+namespace vgTrace {
+
+typedef void (*sinkFunc)(const char *name, uint64_t beginNs, uint64_t endNs, void *userData);
+
+struct event { const char *name; uint64_t beginNs, endNs; };
+
+// built-in sink: one buffer for thread, written only from its thread (count
+// published with release), buffers linked in a lock-free list (never freed)
+struct threadBuffer {
+    event events[VGIZMO_TRACE_EVENTS_PER_THREAD];
+    std::atomic<uint32_t> count { 0 }, dropped { 0 };
+    uint32_t threadId = 0;
+    threadBuffer *next = nullptr;
+};
+
+struct traceState {
+    std::atomic<sinkFunc> sink { nullptr };
+    std::atomic<void *> userData { nullptr };
+    std::atomic<threadBuffer *> buffers { nullptr };
+    std::atomic<uint32_t> threads { 0 };
+    const std::chrono::steady_clock::time_point epoch = std::chrono::steady_clock::now();
+};
+
+inline traceState &state() { static traceState s; return s; }
+
+inline uint64_t nowNs() {
+    return uint64_t(std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - state().epoch).count());
+}
+
+inline void setSink(sinkFunc func, void *userData = nullptr) {
+    state().userData.store(userData, std::memory_order_relaxed);
+    state().sink.store(func, std::memory_order_release);
+}
+
+inline threadBuffer &localBuffer() {
+    static thread_local threadBuffer *buf = nullptr;
+    if(!buf) {
+        traceState &s = state();
+        buf = new threadBuffer;
+        buf->threadId = s.threads.fetch_add(1, std::memory_order_relaxed) + 1;
+        threadBuffer *head = s.buffers.load(std::memory_order_relaxed);
+        do { buf->next = head; } while(!s.buffers.compare_exchange_weak(head, buf, std::memory_order_release, std::memory_order_relaxed));
+    }
+    return *buf;
+}
+
+inline void record(const char *name, uint64_t beginNs, uint64_t endNs) {
+    traceState &s = state();
+    if(sinkFunc f = s.sink.load(std::memory_order_acquire)) { f(name, beginNs, endNs, s.userData.load(std::memory_order_relaxed)); return; }
+
+    threadBuffer &b = localBuffer();
+    const uint32_t n = b.count.load(std::memory_order_relaxed);
+    if(n >= VGIZMO_TRACE_EVENTS_PER_THREAD) { b.dropped.fetch_add(1, std::memory_order_relaxed); return; }
+    b.events[n] = { name, beginNs, endNs };
+    b.count.store(n + 1, std::memory_order_release);
+}
+
+// built-in sink: restart (call when no zone is open, e.g. between frames)
+inline void clear() {
+    for(threadBuffer *b = state().buffers.load(std::memory_order_acquire); b; b = b->next) {
+        b->count.store(0, std::memory_order_release); b->dropped.store(0, std::memory_order_relaxed);
+    }
+}
+
+// built-in sink ==> Chrome trace-event JSON ("X" complete events, ts/dur in us)
+//      zones completed until now by all threads, returns false if file can't be written
+inline bool writeChromeJson(const char *fileName) {
+    FILE *f = fopen(fileName, "w");
+    if(!f) return false;
+    fprintf(f, "{\"displayTimeUnit\":\"ns\",\"traceEvents\":[\n");
+    fprintf(f, "{\"name\":\"process_name\",\"ph\":\"M\",\"pid\":1,\"tid\":0,\"args\":{\"name\":\"vGizmo3D\"}}");
+    for(threadBuffer *b = state().buffers.load(std::memory_order_acquire); b; b = b->next) {
+        const uint32_t n = b->count.load(std::memory_order_acquire);
+        fprintf(f, ",\n{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":%u,\"args\":{\"name\":\"thread %u (%u dropped)\"}}",
+                b->threadId, b->threadId, b->dropped.load(std::memory_order_relaxed));
+        for(uint32_t i = 0; i < n; i++) {
+            const event &e = b->events[i];
+            fprintf(f, ",\n{\"name\":\"%s\",\"ph\":\"X\",\"pid\":1,\"tid\":%u,\"ts\":%.3f,\"dur\":%.3f}",
+                    e.name, b->threadId, e.beginNs * 1e-3, (e.endNs - e.beginNs) * 1e-3);
+        }
+    }
+    fprintf(f, "\n]}\n");
+    return fclose(f) == 0;
+}
+
+class zone {
+public:
+    explicit zone(const char *name) : name(name), beginNs(nowNs()) {}
+    ~zone() { end(); }
+    void end() { if(name) { record(name, beginNs, nowNs()); name = nullptr; } }
+private:
+    const char *name;
+    uint64_t beginNs;
+};
+
+} // namespace vgTrace
+
+#define VGIZMO_ZONE_CAT2(a, b) a##b
+#define VGIZMO_ZONE_CAT(a, b) VGIZMO_ZONE_CAT2(a, b)
+#define VGIZMO_ZONE(name)            vgTrace::zone VGIZMO_ZONE_CAT(vgZone_, __LINE__)(name)
+#define VGIZMO_ZONE_BEGIN(var, name) vgTrace::zone var(name)
+#define VGIZMO_ZONE_END(var)         var.end()
+
+#else
+
+#define VGIZMO_ZONE(name)
+#define VGIZMO_ZONE_BEGIN(var, name)
+#define VGIZMO_ZONE_END(var)
+
+#endif
@@ -10,6 +10,10 @@
 //
 //  This software is distributed under the terms of the BSD 2-Clause license
 //------------------------------------------------------------------------------
+#include <chrono>
+#include <cstring>
+#include <algorithm>
+
 #include "qJulia.h"
 
 #include "glWindow.h"
@@ -156,6 +160,11 @@ void glWindow::onInit()
 #endif
     qjSet = new qJulia;
 
+    glGenFramebuffers(1, &fbo);
+    glGenTextures(1, &fboTex);
+#if !defined(__EMSCRIPTEN__)
+    glGenQueries(timerQueries, timerQuery);
+#endif
 }
 
 
@@ -164,6 +173,11 @@ void glWindow::onInit()
 /////////////////////////////////////////////////
 void glWindow::onExit()
 {
+    glDeleteFramebuffers(1, &fbo);
+    glDeleteTextures(1, &fboTex);
+#if !defined(__EMSCRIPTEN__)
+    glDeleteQueries(timerQueries, timerQuery);
+#endif
     delete qjSet;
     
 }
@@ -196,7 +210,111 @@ void glWindow::onRender()
 #endif
 
 #endif
-    qjSet->render(); 
+    if(useProgressive) renderProgressive();
+    else               qjSet->render();
+}
+
+//  render target: full window size, interactive passes use only a part of it
+/////////////////////////////////////////////////
+void glWindow::resizeRenderTarget(int w, int h)
+{
+    fboW = w; fboH = h;
+    glBindTexture(GL_TEXTURE_2D, fboTex);
+    glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA8, w, h, 0, GL_RGBA, GL_UNSIGNED_BYTE, nullptr);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+    glBindTexture(GL_TEXTURE_2D, 0);
+
+    glBindFramebuffer(GL_FRAMEBUFFER, fbo);
+    glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, fboTex, 0);
+    glBindFramebuffer(GL_FRAMEBUFFER, 0);
+    progRender.restart();
+}
+
+//  GPU time of passes already completed ==> cost estimate of scheduler
+//  oldest first, never waits: not available ==> read in next frame
+/////////////////////////////////////////////////
+void glWindow::readTimerQueries()
+{
+#if !defined(__EMSCRIPTEN__)
+    for(int n = 0; n < timerQueries; n++) {
+        const int i = (timerNext + n) % timerQueries;
+        if(!timerPending[i]) continue;
+        GLint available = 0;
+        glGetQueryObjectiv(timerQuery[i], GL_QUERY_RESULT_AVAILABLE, &available);
+        if(!available) return;  // next ones are later
+        GLuint64 ns = 0;
+        glGetQueryObjectui64v(timerQuery[i], GL_QUERY_RESULT, &ns);
+        progRender.frameTime(float(ns * 1e-6), timerPass[i]);
+        timerPending[i] = false;
+    }
+#endif
+}
+
+//  progressive::scheduler: while gizmo is active or view/params change render
+//  at reduced resolution (frame time budget), then full resolution and full
+//  render (if enabled), after that only blit of last image
+/////////////////////////////////////////////////
+void glWindow::renderProgressive()
+{
+    const int w = theApp->GetWidth(), h = theApp->GetHeight();
+    if(w <= 0 || h <= 0) return;
+    if(w != fboW || h != fboH) resizeRenderTarget(w, h);
+
+    viewState st;
+    memset(&st, 0, sizeof(st));     // padding bytes too: memcmp compare
+    st.orientation = qjSet->matOrientation; st.position = qjSet->position;
+    st.quatPt = qjSet->quatPt; st.diffuseColor = qjSet->diffuseColor; st.light = qjSet->Light;
+    st.params[0] = qjSet->phongMethod;       st.params[1] = qjSet->specularExponent;
+    st.params[2] = qjSet->specularComponent; st.params[3] = qjSet->normalComponent;
+    st.params[4] = qjSet->epsilon;
+    st.fullRender = qjSet->isFullRender; st.shadow = qjSet->useShadow; st.ao = qjSet->useAO;
+    const bool dirty = viewChanged.changed(st);
+
+#ifdef GLAPP_USE_VIRTUALGIZMO
+    const bool active = progressive::isActive(getGizmo()) || ImGui::IsAnyItemActive();
+#else
+    const bool active = ImGui::IsAnyItemActive();   // imGuIZMO widgets (and sliders) dragged
+#endif
+
+    readTimerQueries();     // passes of previous frames
+
+    progressive::pass p;
+    progRender.setQualityLimit(qjSet->isFullRender ? 1 : 0);
+    if(progRender.next(active, dirty, p)) {
+        lastW = std::max(1, int(w * p.scale + .5f));
+        lastH = std::max(1, int(h * p.scale + .5f));
+        const bool fullRender = qjSet->isFullRender;
+        qjSet->isFullRender = fullRender && p.quality > 0;
+
+        glBindFramebuffer(GL_FRAMEBUFFER, fbo);
+        glViewport(0, 0, lastW, lastH);
+#if !defined(__EMSCRIPTEN__)
+        // GPU time of the pass: cost estimate ==> next interactive scale, read in next frames
+        const bool measure = !timerPending[timerNext];  // all queries in flight: pass not measured
+        if(measure) glBeginQuery(GL_TIME_ELAPSED, timerQuery[timerNext]);
+        qjSet->render(lastW, lastH);
+        if(measure) {
+            glEndQuery(GL_TIME_ELAPSED);
+            timerPass[timerNext] = p; timerPending[timerNext] = true;
+            timerNext = (timerNext + 1) % timerQueries;
+        }
+#else
+        // WebGL2: no timer queries (EXT_disjoint_timer_query_webgl2 rarely exposed)
+        const auto start = std::chrono::steady_clock::now();
+        qjSet->render(lastW, lastH);
+        glFinish();
+        progRender.frameTime(std::chrono::duration<float, std::milli>(std::chrono::steady_clock::now() - start).count());
+#endif
+        glBindFramebuffer(GL_FRAMEBUFFER, 0);
+        qjSet->isFullRender = fullRender;
+    }
+
+    glBindFramebuffer(GL_READ_FRAMEBUFFER, fbo);
+    glBlitFramebuffer(0, 0, lastW, lastH, 0, 0, w, h, GL_COLOR_BUFFER_BIT, GL_LINEAR);
+    glBindFramebuffer(GL_READ_FRAMEBUFFER, 0);
+    glViewport(0, 0, w, h);
+    CHECK_GL_ERROR();
 }
 
 
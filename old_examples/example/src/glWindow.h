@@ -14,6 +14,7 @@
 
 #include "glApp.h"
 #include <vGizmo.h>
+#include <utils/progressiveRender.h>
 
 //#define GLAPP_USE_VIRTUALGIZMO
 
@@ -110,7 +111,32 @@ public:
 
     class qJulia *qjSet;
 
+    // progressive render: reduced resolution while view changes, refine when idle
+    bool useProgressive = true;
+    progressive::scheduler progRender;
+
 private:
+    void renderProgressive();
+    void resizeRenderTarget(int w, int h);
+    void readTimerQueries();
+
+    GLuint fbo = 0, fboTex = 0;
+    int fboW = 0, fboH = 0;         // render target size (window size)
+    int lastW = 0, lastH = 0;       // last rendered size (scaled)
+
+    // GPU time of passes: GL_TIME_ELAPSED queries read back in next frames (no glFinish)
+    enum { timerQueries = 3 };
+    GLuint timerQuery[timerQueries] = {};
+    progressive::pass timerPass[timerQueries];   // pass measured by query
+    bool timerPending[timerQueries] = {};
+    int timerNext = 0;                           // next query to use (ring), also the oldest pending
+
+    struct viewState {
+        mat3 orientation; vec3 position; vec4 quatPt; vec3 diffuseColor, light;
+        float params[5];
+        bool fullRender, shadow, ao;
+    };
+    progressive::changeTracker<viewState> viewChanged;
 
     
 };
@@ -65,12 +65,17 @@ void qJulia::initShaders()
 }
 
 void qJulia::render() 
+{
+    render(theApp->GetWidth(), theApp->GetHeight());
+}
+
+void qJulia::render(int width, int height) 
 {
     bindPipeline();
     bindProgram();
 
     glUniform4fv(_quatPt            ,1  , value_ptr(quatPt));
-    glUniform3fv(_Resolution        ,1  , value_ptr(vec3(theApp->GetWidth(), theApp->GetHeight(),float(theApp->GetWidth())/float(theApp->GetHeight()))));
+    glUniform3fv(_Resolution        ,1  , value_ptr(vec3(width, height, float(width)/float(height))));
     glUniform3fv(_diffuseColor      ,1  , value_ptr(diffuseColor));
     glUniform3fv(_Light             ,1  , value_ptr(Light));
 
@@ -83,6 +83,7 @@ public:
 
     void initShaders();
     void render();
+    void render(int width, int height);    // current viewport size (e.g. reduced resolution)
 
     vec4 quatPt = vec4(-0.65f, 0.4f, 0.25f, 0.05f);
     vec3 diffuseColor = vec3(0.3f,0.9f,0.65f);
@@ -0,0 +1,275 @@
+//------------------------------------------------------------------------------
+//  Copyright (c) 2018-2025 Michele Morrone
+//  All rights reserved.
+//
+//  https://michelemorrone.eu - https://brutpitt.com
+//
+//  X: https://x.com/BrutPitt - GitHub: https://github.com/BrutPitt
+//
+//  direct mail: brutpitt(at)gmail.com - me(at)michelemorrone.eu
+//
+//  This software is distributed under the terms of the BSD 2-Clause license
+//------------------------------------------------------------------------------
+#include <thread>
+#include <atomic>
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+
+#include "qJuliaCPU.h"
+
+// same constants of qjFragES2.glsl
+static const float Eye[3] = { 0.f, 0.f, 2.2f };
+static const float Slice = 0.f;
+static const int   maxIterations = 10;
+static const int   maxSteps = 250;
+static const float BOUNDING_RAD = 8.f;
+static const float ESCAPE_THRESHOLD = 1e1f;
+static const float D_EPS = 1e-4f;
+
+#define NR 1.f
+static const float sampleCoord[9][3] = { {  0.,  0., 1. }, {  NR, -NR, .3f }, { -NR,  NR, .3f },
+                                         {  NR,  NR, .3f }, { -NR, -NR, .3f }, {   0,  NR, .5f },
+                                         {   0, -NR, .5f }, {  NR,   0, .5f }, { -NR,   0, .5f } };
+#undef NR
+
+static inline void mulMat3(const float *m, const float *v, float *r)
+{
+    r[0] = m[0]*v[0] + m[3]*v[1] + m[6]*v[2];
+    r[1] = m[1]*v[0] + m[4]*v[1] + m[7]*v[2];
+    r[2] = m[2]*v[0] + m[5]*v[1] + m[8]*v[2];
+}
+
+//  IntersectQJulia: march all active lanes together, lanes that hit or escape
+//  are frozen (select), packet ends when all lanes are done
+//  out: dist (last step, hit if < eps), trapW (AO), ox/oy/oz = last point
+////////////////////////////////////////////////////////////////////////////
+template<int LANES> void qJuliaCPU::intersect(float *ox, float *oy, float *oz, const float *dx, const float *dy, const float *dz,
+                                               const int *active, float *dist, float *trapW)
+{
+    const float cr = fr.c[0], ci = fr.c[1], cj = fr.c[2], ck = fr.c[3];
+    const float eps = fr.eps;
+
+    int run[LANES];
+    int nRun = 0;
+    for(int l = 0; l < LANES; l++) { run[l] = active[l]; dist[l] = 1.f; trapW[l] = 0.f; nRun += run[l]; }
+
+    for(int step = 0; step < maxSteps && nRun; step++) {
+        float zr[LANES], zi[LANES], zj[LANES], zk[LANES];
+        float pr[LANES], pi[LANES], pj[LANES], pk[LANES];
+        float tw[LANES];
+        int alive[LANES];
+        for(int l = 0; l < LANES; l++) {
+            zr[l] = ox[l]; zi[l] = oy[l]; zj[l] = oz[l]; zk[l] = Slice;
+            pr[l] = 1.f;   pi[l] = 0.f;   pj[l] = 0.f;   pk[l] = 0.f;
+            tw[l] = zr[l]*zr[l] + zi[l]*zi[l] + zj[l]*zj[l] + zk[l]*zk[l];
+            alive[l] = 1;
+        }
+
+        // IterateIntersect: zp = 2 * z * zp, z = z^2 + c, escaped lanes frozen
+        for(int h = 0, nAlive = LANES; h < maxIterations && nAlive; h++) {
+            nAlive = 0;
+            for(int l = 0; l < LANES; l++) {
+                const float npr = 2.f * (zr[l]*pr[l] - (zi[l]*pi[l] + zj[l]*pj[l] + zk[l]*pk[l]));
+                const float npi = 2.f * (zr[l]*pi[l] + pr[l]*zi[l] + (zj[l]*pk[l] - zk[l]*pj[l]));
+                const float npj = 2.f * (zr[l]*pj[l] + pr[l]*zj[l] + (zk[l]*pi[l] - zi[l]*pk[l]));
+                const float npk = 2.f * (zr[l]*pk[l] + pr[l]*zk[l] + (zi[l]*pj[l] - zj[l]*pi[l]));
+                const float nzr = zr[l]*zr[l] - (zi[l]*zi[l] + zj[l]*zj[l] + zk[l]*zk[l]) + cr;
+                const float nzi = 2.f * zr[l]*zi[l] + ci;
+                const float nzj = 2.f * zr[l]*zj[l] + cj;
+                const float nzk = 2.f * zr[l]*zk[l] + ck;
+                const float m = nzr*nzr + nzi*nzi + nzj*nzj + nzk*nzk;
+                const bool a = alive[l] != 0;
+                pr[l] = a ? npr : pr[l]; pi[l] = a ? npi : pi[l]; pj[l] = a ? npj : pj[l]; pk[l] = a ? npk : pk[l];
+                zr[l] = a ? nzr : zr[l]; zi[l] = a ? nzi : zi[l]; zj[l] = a ? nzj : zj[l]; zk[l] = a ? nzk : zk[l];
+                tw[l] = a && m < tw[l] ? m : tw[l];
+                alive[l] = a && m <= ESCAPE_THRESHOLD;
+                nAlive += alive[l];
+            }
+        }
+
+        // dist = .5 * |z| * log|z| / |zp|, march running lanes
+        nRun = 0;
+        for(int l = 0; l < LANES; l++) {
+            const float normZ = std::sqrt(zr[l]*zr[l] + zi[l]*zi[l] + zj[l]*zj[l] + zk[l]*zk[l]);
+            const float normP = std::sqrt(pr[l]*pr[l] + pi[l]*pi[l] + pj[l]*pj[l] + pk[l]*pk[l]);
+            const float d = .5f * normZ * std::log(normZ) / normP;
+            const bool r = run[l] != 0;
+            const float x = ox[l] + dx[l]*d, y = oy[l] + dy[l]*d, z = oz[l] + dz[l]*d;
+            ox[l] = r ? x : ox[l]; oy[l] = r ? y : oy[l]; oz[l] = r ? z : oz[l];
+            dist[l]  = r ? d : dist[l];
+            trapW[l] = r ? tw[l] : trapW[l];
+            run[l] = r && !(d < eps || x*x + y*y + z*z > BOUNDING_RAD);
+            nRun += run[l];
+        }
+    }
+}
+
+//  NormEstimate: 4 points (p, p+dx, p+dy, p+dz) for lane ==> 4*LANES independent lanes
+////////////////////////////////////////////////////////////////////////////
+template<int LANES> void qJuliaCPU::normals(const float *px, const float *py, const float *pz, const int *active,
+                                             float *nx, float *ny, float *nz)
+{
+    const int N = LANES * 4;
+    const float cr = fr.c[0], ci = fr.c[1], cj = fr.c[2], ck = fr.c[3];
+    float gr[N], gi[N], gj[N], gk[N];
+    for(int l = 0; l < LANES; l++) {
+        for(int g = 0; g < 4; g++) {
+            gr[g*LANES + l] = px[l] + (g == 1 ? D_EPS : 0.f);
+            gi[g*LANES + l] = py[l] + (g == 2 ? D_EPS : 0.f);
+            gj[g*LANES + l] = pz[l] + (g == 3 ? D_EPS : 0.f);
+            gk[g*LANES + l] = Slice;
+        }
+    }
+    for(int i = 0; i < maxIterations; i++) {
+        for(int l = 0; l < N; l++) {
+            const float r = gr[l]*gr[l] - (gi[l]*gi[l] + gj[l]*gj[l] + gk[l]*gk[l]) + cr;
+            const float r2 = 2.f * gr[l];
+            gi[l] = r2*gi[l] + ci; gj[l] = r2*gj[l] + cj; gk[l] = r2*gk[l] + ck;
+            gr[l] = r;
+        }
+    }
+    float len[N];
+    for(int l = 0; l < N; l++) len[l] = std::sqrt(gr[l]*gr[l] + gi[l]*gi[l] + gj[l]*gj[l] + gk[l]*gk[l]);
+    for(int l = 0; l < LANES; l++) {
+        const float dX = len[LANES + l] - len[l], dY = len[2*LANES + l] - len[l], dZ = len[3*LANES + l] - len[l];
+        const float inv = 1.f / std::sqrt(dX*dX + dY*dY + dZ*dZ);
+        nx[l] = active[l] ? dX * inv : 0.f;
+        ny[l] = active[l] ? dY * inv : 0.f;
+        nz[l] = active[l] ? dZ * inv : 0.f;
+    }
+}
+
+//  renderTile: LANES adjacent pixels of same row for packet
+////////////////////////////////////////////////////////////////////////////
+template<int LANES> void qJuliaCPU::renderTile(int x0, int y0, int x1, int y1, int width, int height, uint8_t *rgb)
+{
+    const int nSamples = isFullRender ? 9 : 1;
+    const float colorDiv  = isFullRender ? 4.f : 1.f;
+    const float shadowDiv = isFullRender ? 9.f : 1.f;
+    const float *m = fr.orient;
+    const float eps = fr.eps;
+
+    for(int y = y0; y < y1; y++) {
+        for(int x = x0; x < x1; x += LANES) {
+            float colR[LANES] = {}, colG[LANES] = {}, colB[LANES] = {}, colShadow[LANES] = {};
+            int inside[LANES];
+            for(int l = 0; l < LANES; l++) inside[l] = x + l < x1;
+
+            for(int s = 0; s < nSamples; s++) {
+                float ox[LANES], oy[LANES], oz[LANES], dx[LANES], dy[LANES], dz[LANES];
+                float dist[LANES], trapW[LANES];
+                for(int l = 0; l < LANES; l++) {
+                    // gl_FragCoord = pixel center, y from bottom
+                    const float fx = float(x + l) + .5f, fy = float(height - 1 - y) + .5f;
+                    const float u = ((fx*2.f + sampleCoord[s][0]) / float(width)  - 1.f) * fr.aspect + fr.pos[0];
+                    const float v =  (fy*2.f + sampleCoord[s][1]) / float(height) - 1.f + fr.pos[1];
+                    const float w = -1.f + fr.pos[2];
+                    dx[l] = m[0]*u + m[3]*v + m[6]*w;
+                    dy[l] = m[1]*u + m[4]*v + m[7]*w;
+                    dz[l] = m[2]*u + m[5]*v + m[8]*w;
+                    ox[l] = fr.origin[0]; oy[l] = fr.origin[1]; oz[l] = fr.origin[2];
+                }
+                intersect<LANES>(ox, oy, oz, dx, dy, dz, inside, dist, trapW);
+
+                int hit[LANES], nHit = 0;
+                for(int l = 0; l < LANES; l++) { hit[l] = inside[l] && dist[l] < eps; nHit += hit[l]; }
+                if(!nHit) continue;
+
+                float nx[LANES], ny[LANES], nz[LANES];
+                normals<LANES>(ox, oy, oz, hit, nx, ny, nz);
+
+                // Phong (+ AO)
+                for(int l = 0; l < LANES; l++) {
+                    const float Nx = nx[l]*phongMethod, Ny = ny[l]*phongMethod, Nz = nz[l]*phongMethod;
+                    float Lx = fr.lightPhong[0] - ox[l], Ly = fr.lightPhong[1] - oy[l], Lz = fr.lightPhong[2] - oz[l];
+                    float Ex = fr.eye[0] - ox[l], Ey = fr.eye[1] - oy[l], Ez = fr.eye[2] - oz[l];
+                    const float iL = 1.f / std::sqrt(Lx*Lx + Ly*Ly + Lz*Lz), iE = 1.f / std::sqrt(Ex*Ex + Ey*Ey + Ez*Ez);
+                    Lx *= iL; Ly *= iL; Lz *= iL; Ex *= iE; Ey *= iE; Ez *= iE;
+                    const float NdotL = Nx*Lx + Ny*Ly + Nz*Lz;
+                    const float Rx = Lx - 2.f*NdotL*Nx, Ry = Ly - 2.f*NdotL*Ny, Rz = Lz - 2.f*NdotL*Nz;
+                    const float diff = NdotL > 0.f ? NdotL : 0.f;
+                    const float ER = Ex*Rx + Ey*Ry + Ez*Rz;
+                    const float spec = specularComponent * std::pow(ER > 0.f ? ER : 0.f, specularExponent);
+                    const float ao = useAO ? .5f + .5f * std::min(std::max(trapW[l] * 1.5f, 0.f), 1.f) : 1.f;
+                    const float k = hit[l] ? ao * sampleCoord[s][2] : 0.f;
+                    colR[l] += (.1f + (diffuseColor.x + std::abs(Nx)*normalComponent) * diff + spec) * k;
+                    colG[l] += (.1f + (diffuseColor.y + std::abs(Ny)*normalComponent) * diff + spec) * k;
+                    colB[l] += (.1f + (diffuseColor.z + std::abs(Nz)*normalComponent) * diff + spec) * k;
+                }
+
+                if(useShadow) {
+                    for(int l = 0; l < LANES; l++) {
+                        float Lx = fr.light[0] - ox[l], Ly = fr.light[1] - oy[l], Lz = fr.light[2] - oz[l];
+                        const float iL = 1.f / std::sqrt(Lx*Lx + Ly*Ly + Lz*Lz);
+                        dx[l] = Lx * iL; dy[l] = Ly * iL; dz[l] = Lz * iL;
+                        ox[l] += nx[l]*eps*2.f; oy[l] += ny[l]*eps*2.f; oz[l] += nz[l]*eps*2.f;
+                    }
+                    intersect<LANES>(ox, oy, oz, dx, dy, dz, hit, dist, trapW);
+                    for(int l = 0; l < LANES; l++) colShadow[l] += hit[l] ? (dist[l] < eps ? .5f : 1.f) : 0.f;
+                }
+            }
+
+            for(int l = 0; l < LANES && x + l < x1; l++) {
+                const float sh = useShadow ? colShadow[l] / shadowDiv : 1.f;
+                const float c[3] = { colR[l] / colorDiv * sh, colG[l] / colorDiv * sh, colB[l] / colorDiv * sh };
+                uint8_t *p = rgb + (size_t(y) * width + x + l) * 3;
+                for(int i = 0; i < 3; i++) p[i] = uint8_t(c[i] > 0.f ? (c[i] < 1.f ? c[i] * 255.f + .5f : 255.f) : 0.f);  // NaN ==> 0
+            }
+        }
+    }
+}
+
+void qJuliaCPU::render(int width, int height, std::vector<uint8_t> &rgb, int threads, int lanes)
+{
+    rgb.resize(size_t(width) * height * 3);
+    if(width <= 0 || height <= 0) return;
+
+    // same uniforms of qJulia::render(): -position, transpose(matOrientation)
+    const mat3 o = transpose(matOrientation);
+    for(int c = 0; c < 3; c++) for(int r = 0; r < 3; r++) fr.orient[c*3 + r] = float(o[c][r]);
+    for(int i = 0; i < 4; i++) fr.c[i] = float(quatPt[i]);
+    for(int i = 0; i < 3; i++) fr.pos[i] = -float(position[i]);
+
+    const float eyePos[3]   = { Eye[0] + fr.pos[0], Eye[1] + fr.pos[1], Eye[2] + fr.pos[2] };
+    const float light[3]    = { float(Light.x), float(Light.y), float(Light.z) };
+    const float lightPh[3]  = { light[0]*phongMethod, light[1]*phongMethod, light[2]*phongMethod };
+    mulMat3(fr.orient, eyePos,  fr.origin);
+    mulMat3(fr.orient, Eye,     fr.eye);
+    mulMat3(fr.orient, light,   fr.light);
+    mulMat3(fr.orient, lightPh, fr.lightPhong);
+    fr.aspect = float(width) / float(height);
+    fr.eps = epsilon;
+
+    const int tilesX = (width + tileSize - 1) / tileSize, tilesY = (height + tileSize - 1) / tileSize;
+    const int nTiles = tilesX * tilesY;
+    std::atomic<int> nextTile(0);
+    auto worker = [&]() {
+        for(int t = nextTile++; t < nTiles; t = nextTile++) {
+            const int x0 = (t % tilesX) * tileSize, y0 = (t / tilesX) * tileSize;
+            const int x1 = x0 + tileSize < width ? x0 + tileSize : width, y1 = y0 + tileSize < height ? y0 + tileSize : height;
+            switch(lanes) {
+                case 1:  renderTile<1>(x0, y0, x1, y1, width, height, rgb.data()); break;
+                case 4:  renderTile<4>(x0, y0, x1, y1, width, height, rgb.data()); break;
+                default: renderTile<8>(x0, y0, x1, y1, width, height, rgb.data()); break;
+            }
+        }
+    };
+
+    if(threads <= 0) threads = int(std::thread::hardware_concurrency());
+    if(threads > nTiles) threads = nTiles;
+    std::vector<std::thread> pool;
+    for(int i = 1; i < threads; i++) pool.emplace_back(worker);
+    worker();
+    for(auto &t : pool) t.join();
+}
+
+bool qJuliaCPU::writePPM(const char *fileName, int width, int height, const std::vector<uint8_t> &rgb)
+{
+    FILE *f = fopen(fileName, "wb");
+    if(!f) return false;
+    fprintf(f, "P6\n%d %d\n255\n", width, height);
+    const bool ok = fwrite(rgb.data(), 1, rgb.size(), f) == rgb.size();
+    fclose(f);
+    return ok;
+}
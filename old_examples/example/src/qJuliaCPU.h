@@ -0,0 +1,96 @@
+//------------------------------------------------------------------------------
+//  Copyright (c) 2018-2025 Michele Morrone
+//  All rights reserved.
+//
+//  https://michelemorrone.eu - https://brutpitt.com
+//
+//  X: https://x.com/BrutPitt - GitHub: https://github.com/BrutPitt
+//
+//  direct mail: brutpitt(at)gmail.com - me(at)michelemorrone.eu
+//
+//  This software is distributed under the terms of the BSD 2-Clause license
+//------------------------------------------------------------------------------
+#pragma once
+
+#include <vector>
+#include <cstdint>
+
+#include <vgMath.h>
+
+// CPU reference renderer of quaternion Julia set: same distance estimator
+// ray marching of Shaders/qjFragES2.glsl (IntersectQJulia, NormEstimate, Phong,
+// shadow, AO and 9 samples "full render"), no GPU needed
+//
+//  rays in packets of LANES (1 / 4 / 8): SoA lanes of plain float arrays with
+//      masks, loops written to be auto-vectorized by the compiler (vgMath has no
+//      packet types: its SIMD kernels are batch transforms, not used here)
+//      GCC vectorizes them only with -ffast-math (log/sqrt) and AVX, e.g.
+//      -march=native (cmake -DQJSETCPU_NATIVE:BOOL=TRUE), 512x512, 1 thread:
+//          -O3                            lanes 1 0.70 - 4 0.54 - 8 0.49 Mrays/s
+//          -O3 -ffast-math -march=native  lanes 1 0.88 - 4 1.77 - 8 2.25 Mrays/s
+//      scalar code is faster w/o them: default lanes is 1 in that case
+//  image split in tiles (32x32) distributed on threads with an atomic counter
+//------------------------------------------------------------------------------
+class qJuliaCPU
+{
+public:
+    // same uniforms of qJulia::render()
+    vec4 quatPt = vec4(-0.65f, 0.4f, 0.25f, 0.05f);
+    vec3 diffuseColor = vec3(0.3f,0.9f,0.65f);
+    vec3 Light = vec3(3.f,3.f,3.f);
+
+    float phongMethod           = 1.0f ;
+    float specularExponent      = 15.f;
+    float specularComponent     = .5f  ;
+    float normalComponent       = .25f ;
+    float epsilon               = 0.001f;
+
+    bool isFullRender = false;
+    bool useShadow    = true;
+    bool useAO        = false;
+
+    mat3 matOrientation = mat3(1.0f);
+    vec3 position = vec3(0.f);
+
+    // copy current state of qJulia (or any class with same members)
+    template<class Q> void setFromState(const Q &q) {
+        quatPt = q.quatPt; diffuseColor = q.diffuseColor; Light = q.Light;
+        phongMethod = q.phongMethod; specularExponent = q.specularExponent;
+        specularComponent = q.specularComponent; normalComponent = q.normalComponent;
+        epsilon = q.epsilon;
+        isFullRender = q.isFullRender; useShadow = q.useShadow; useAO = q.useAO;
+        matOrientation = q.matOrientation; position = q.position;
+    }
+
+    // render RGB 8 bit (top/left origin) with "threads" threads (0 ==> hardware threads)
+    // and "lanes" rays for packet: 1, 4 or 8
+#if defined(__FAST_MATH__) && defined(__AVX__)
+    enum { defaultLanes = 8 };
+#else
+    enum { defaultLanes = 1 };
+#endif
+    void render(int width, int height, std::vector<uint8_t> &rgb, int threads = 0, int lanes = defaultLanes);
+
+    static bool writePPM(const char *fileName, int width, int height, const std::vector<uint8_t> &rgb);
+
+    enum { tileSize = 32 };
+
+private:
+    template<int LANES> void renderTile(int x0, int y0, int x1, int y1, int width, int height, uint8_t *rgb);
+    template<int LANES> void intersect(float *ox, float *oy, float *oz, const float *dx, const float *dy, const float *dz,
+                                       const int *active, float *dist, float *trapW);
+    template<int LANES> void normals(const float *px, const float *py, const float *pz, const int *active,
+                                     float *nx, float *ny, float *nz);
+
+    // frame constants (from state, as qJulia::render() uniforms)
+    struct {
+        float c[4];             // quatPt
+        float orient[9];        // transpose(matOrientation), column major
+        float origin[3];        // orient * (Eye + pos)
+        float eye[3];           // orient * Eye
+        float light[3];         // orient * Light
+        float lightPhong[3];    // orient * (Light * phongMethod)
+        float pos[3];           // -position
+        float aspect, eps;
+    } fr;
+};
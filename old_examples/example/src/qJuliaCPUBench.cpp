@@ -0,0 +1,137 @@
+//------------------------------------------------------------------------------
+//  Copyright (c) 2018-2025 Michele Morrone
+//  All rights reserved.
+//
+//  https://michelemorrone.eu - https://brutpitt.com
+//
+//  X: https://x.com/BrutPitt - GitHub: https://github.com/BrutPitt
+//
+//  direct mail: brutpitt(at)gmail.com - me(at)michelemorrone.eu
+//
+//  This software is distributed under the terms of the BSD 2-Clause license
+//------------------------------------------------------------------------------
+//
+//  qJuliaCPU benchmark (no window, no GPU): renders the default qJulia state
+//  with 1, 2, 4 ... hardware threads and 1 / 4 / 8 rays for packet, prints
+//  primary rays/s (pixels * samples) and scaling, writes last image (PPM)
+//
+//  -p budget: progressive::scheduler simulation (commons/utils/progressiveRender.h),
+//  two drags of 30 frames + idle frames: rendered scale and time of frames
+//
+//  usage: qjSetCPU [-w width] [-h height] [-f] [-s] [-a] [-r repeat] [-t threads] [-p budgetMs] [-o out.ppm]
+//      -f ==> full render (9 samples)   -s ==> no shadow   -a ==> AO
+//------------------------------------------------------------------------------
+#include <thread>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <algorithm>
+
+#include "qJuliaCPU.h"
+#include "utils/progressiveRender.h"
+
+static double msSince(std::chrono::steady_clock::time_point start)
+{
+    return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+}
+
+// two drags of 30 frames (gizmo active), refine passes in the idle frames after each one
+static void progressiveSim(qJuliaCPU &qj, int width, int height, int threads, float budget, std::vector<uint8_t> &rgb)
+{
+    const bool fullRender = qj.isFullRender;
+    progressive::scheduler sched;
+    sched.setBudget(budget);
+    sched.setQualityLimit(fullRender ? 1 : 0);
+    progressive::changeTracker<quat> viewChanged;
+
+    const auto start = std::chrono::steady_clock::now();
+    qj.render(width, height, rgb, threads);
+    const double fullMs = msSince(start);
+    printf("progressive: budget %.1f ms - full resolution frame %.2f ms\n", budget, fullMs);
+
+    quat q(1.f, 0.f, 0.f, 0.f);
+    const quat step = angleAxis(.02f, normalize(vec3(.3f, 1.f, .1f)));
+    double interMs = 0, interMax = 0;
+    int interFrames = 0;
+    bool complete = false;
+    for(int frame = 0; frame < 90; frame++) {
+        const bool active = frame < 30 || (frame >= 45 && frame < 75);     // two drags
+        if(active) q = normalize(step * q);
+        qj.matOrientation = mat3_cast(q);
+
+        progressive::pass p;
+        if(!sched.next(active, viewChanged.changed(q), p)) {
+            if(!complete) printf("frame %2d: complete (no render until next change)\n", frame);
+            complete = true;
+            continue;
+        }
+        complete = false;
+        qj.isFullRender = fullRender && p.quality > 0;
+        const int w = std::max(1, int(width * p.scale + .5f)), h = std::max(1, int(height * p.scale + .5f));
+        const auto t0 = std::chrono::steady_clock::now();
+        qj.render(w, h, rgb, threads);
+        const double ms = msSince(t0);
+        sched.frameTime(float(ms));
+        if(sched.isInteractive()) { interMs += ms; interMax = std::max(interMax, ms); interFrames++; }
+        if(!active || frame % 5 == 0)
+            printf("frame %2d: %s scale %.3f quality %d - %4dx%-4d %8.2f ms\n", frame, active ? "drag  " : "refine", p.scale, p.quality, w, h, ms);
+    }
+    qj.isFullRender = fullRender;
+    if(interFrames) printf("drag frames: avg %.2f ms - max %.2f ms (budget %.1f, full resolution %.2f)\n", interMs / interFrames, interMax, budget, fullMs);
+}
+
+int main(int argc, char **argv)
+{
+    int width = 640, height = 480, repeat = 3, threads = 0;
+    float budget = 0;
+    const char *outFile = "qJuliaCPU.ppm";
+    qJuliaCPU qj;
+    for(int a = 1; a < argc; a++) {
+        if     (!strcmp(argv[a], "-w") && a+1 < argc) width  = atoi(argv[++a]);
+        else if(!strcmp(argv[a], "-h") && a+1 < argc) height = atoi(argv[++a]);
+        else if(!strcmp(argv[a], "-r") && a+1 < argc) repeat = atoi(argv[++a]);
+        else if(!strcmp(argv[a], "-o") && a+1 < argc) outFile = argv[++a];
+        else if(!strcmp(argv[a], "-t") && a+1 < argc) threads = atoi(argv[++a]);
+        else if(!strcmp(argv[a], "-p") && a+1 < argc) budget = float(atof(argv[++a]));
+        else if(!strcmp(argv[a], "-f")) qj.isFullRender = true;
+        else if(!strcmp(argv[a], "-s")) qj.useShadow = false;
+        else if(!strcmp(argv[a], "-a")) qj.useAO = true;
+        else { fprintf(stderr, "usage: %s [-w width] [-h height] [-f] [-s] [-a] [-r repeat] [-t threads] [-p budgetMs] [-o out.ppm]\n", argv[0]); return EXIT_FAILURE; }
+    }
+    if(width <= 0 || height <= 0 || repeat <= 0) return EXIT_FAILURE;
+
+    // a not axis aligned view, same of a little drag with vGizmo3D
+    qj.matOrientation = mat3_cast(normalize(quat(.95f, .2f, .25f, 0.f)));
+
+    const double rays = double(width) * height * (qj.isFullRender ? 9 : 1);
+    const int hwThreads = std::max(1, int(std::thread::hardware_concurrency()));
+    printf("%dx%d - samples %d - shadow %d - AO %d - hardware threads %d\n", width, height,
+           qj.isFullRender ? 9 : 1, qj.useShadow, qj.useAO, hwThreads);
+
+    std::vector<uint8_t> rgb;
+    if(budget > 0.f) {
+        progressiveSim(qj, width, height, threads, budget, rgb);
+        return EXIT_SUCCESS;
+    }
+
+    const int lanes[] = { 1, 4, 8 };
+    for(int ln : lanes) {
+        double base = 0;
+        for(int th = 1; ; th = std::min(th * 2, hwThreads)) {
+            double best = 1e30;
+            for(int r = 0; r < repeat; r++) {
+                const auto start = std::chrono::steady_clock::now();
+                qj.render(width, height, rgb, th, ln);
+                best = std::min(best, std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count());
+            }
+            if(th == 1) base = best;
+            printf("lanes %d - threads %2d: %8.2f ms - %7.2f Mrays/s - speedup %5.2f\n", ln, th, best * 1e3, rays / best * 1e-6, base / best);
+            if(th == hwThreads) break;
+        }
+    }
+
+    if(!qJuliaCPU::writePPM(outFile, width, height, rgb)) { fprintf(stderr, "%s: write error\n", outFile); return EXIT_FAILURE; }
+    printf("image: %s\n", outFile);
+    return EXIT_SUCCESS;
+}
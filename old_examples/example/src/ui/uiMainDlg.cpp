@@ -108,6 +108,15 @@ void mainImGuiDlgClass::renderImGui()
             ImGui::Checkbox("full render", &theWnd->qjSet->isFullRender);
             ImGui::PopItemWidth();
 
+            ImGui::Checkbox("progressive", &theWnd->useProgressive);
+            if(theWnd->useProgressive) {
+                ImGui::SameLine(half);
+                ImGui::PushItemWidth(half);
+                float budget = theWnd->progRender.getBudget();
+                if(ImGui::SliderFloat("##budget", &budget, 2.f, 33.f, "budget %.1f ms")) theWnd->progRender.setBudget(budget);
+                ImGui::PopItemWidth();
+            }
+
             ImGui::Text(" ");
             ImGui::Text("Light & colors");
 